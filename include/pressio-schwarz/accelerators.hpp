@@ -0,0 +1,285 @@
+//@HEADER
+// ************************************************************************
+//
+//                     		       Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Chris Wentland (crwentl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+
+#ifndef PRESSIODEMOAPPS_SCHWARZ_ACCELERATORS_HPP_
+#define PRESSIODEMOAPPS_SCHWARZ_ACCELERATORS_HPP_
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <Eigen/Dense>
+
+
+namespace pschwarz{
+
+enum class InterfaceAccel{ None, Aitken, Anderson };
+enum class InterfacePredict{ None, Linear, Quadratic };
+
+//
+// Accelerators of the Schwarz fixed-point iteration x_{k+1} = G(x_k), acting on the
+// boundary state (m_stateBCs) of a single subdomain. On entry to apply(), the boundary
+// state holds the raw neighbor values G(x_k), which are overwritten with x_{k+1}.
+//
+template<class state_t>
+class InterfaceAcceleratorBase
+{
+public:
+    virtual ~InterfaceAcceleratorBase() = default;
+
+    // start a new fixed-point iteration from the boundary state x_0
+    virtual void reset(const state_t & stateBCs) = 0;
+    virtual void apply(state_t & stateBCs) = 0;
+};
+
+//
+// dynamic Aitken relaxation (Irons-Tuck)
+//
+template<class state_t>
+class AitkenAccelerator : public InterfaceAcceleratorBase<state_t>
+{
+public:
+    explicit AitkenAccelerator(const double omegaInit, const double omegaMax)
+        : m_omegaInit(omegaInit)
+        , m_omegaMax(omegaMax)
+    {
+        if (m_omegaMax <= 0.0) throw std::runtime_error("Aitken omegaMax must be > 0");
+    }
+
+    void reset(const state_t & stateBCs) final {
+        m_x = stateBCs;
+        m_omega = m_omegaInit;
+        m_iter = 0;
+    }
+
+    void apply(state_t & stateBCs) final
+    {
+        state_t resid = stateBCs - m_x;
+
+        if (m_iter > 0) {
+            const state_t residDiff = resid - m_residPrev;
+            const double denom = residDiff.squaredNorm();
+            if (denom > 0.0) {
+                m_omega = -m_omega * m_residPrev.dot(residDiff) / denom;
+                m_omega = std::max(-m_omegaMax, std::min(m_omega, m_omegaMax));
+            }
+        }
+
+        m_x += m_omega * resid;
+        m_residPrev = resid;
+        stateBCs = m_x;
+        m_iter++;
+    }
+
+private:
+    double m_omegaInit;
+    double m_omegaMax;
+    double m_omega = {};
+    int m_iter = 0;
+    state_t m_x;
+    state_t m_residPrev;
+};
+
+//
+// windowed Anderson mixing over the last m_depth interface iterates
+// the least-squares problem is solved through the Gram matrix of the residual differences,
+// of which only the row and column of the newest difference are updated on each apply
+//
+template<class state_t>
+class AndersonAccelerator : public InterfaceAcceleratorBase<state_t>
+{
+    using scalar_t = typename state_t::Scalar;
+    using matrix_t = Eigen::Matrix<scalar_t, -1, -1, Eigen::ColMajor>;
+
+public:
+    AndersonAccelerator(const int depth, const double relax)
+        : m_depth(depth)
+        , m_relax(relax)
+    {
+        if (m_depth < 1) throw std::runtime_error("Anderson depth must be >= 1");
+    }
+
+    void reset(const state_t & stateBCs) final {
+        m_x = stateBCs;
+        m_iter = 0;
+        m_count = 0;
+        m_residDiff.resize(stateBCs.size(), m_depth);
+        m_gDiff.resize(stateBCs.size(), m_depth);
+        m_gram.resize(m_depth, m_depth);
+    }
+
+    void apply(state_t & stateBCs) final
+    {
+        // stateBCs holds g_k = G(x_k)
+        m_resid = stateBCs - m_x;
+
+        if (m_iter > 0) {
+            // oldest column is overwritten once the window is full
+            const int col = (m_iter - 1) % m_depth;
+            m_residDiff.col(col) = m_resid - m_residPrev;
+            m_gDiff.col(col) = stateBCs - m_gPrev;
+            m_count = std::min(m_count + 1, m_depth);
+            for (int j = 0; j < m_count; ++j) {
+                m_gram(col, j) = m_residDiff.col(col).dot(m_residDiff.col(j));
+                m_gram(j, col) = m_gram(col, j);
+            }
+        }
+        m_residPrev = m_resid;
+        m_gPrev = stateBCs;
+
+        if (m_count == 0) {
+            m_x += m_relax * m_resid;
+        }
+        else {
+            // gamma = argmin || r_k - dR * gamma ||, from (dR^T dR) gamma = dR^T r_k
+            const auto dR = m_residDiff.leftCols(m_count);
+            const auto dG = m_gDiff.leftCols(m_count);
+            m_rhs.noalias() = dR.transpose() * m_resid;
+            m_gamma = m_gram.topLeftCorner(m_count, m_count).completeOrthogonalDecomposition().solve(m_rhs);
+
+            // x_{k+1} = (1 - beta) * (x_k - dX * gamma) + beta * (g_k - dG * gamma),
+            //      with dX = dG - dR
+            m_x += m_relax * m_resid;
+            m_x.noalias() -= dG * m_gamma;
+            m_x.noalias() += (1.0 - m_relax) * (dR * m_gamma);
+        }
+
+        stateBCs = m_x;
+        m_iter++;
+    }
+
+private:
+    int m_depth;
+    double m_relax;
+    int m_iter = 0;
+    int m_count = 0;
+    state_t m_x;
+    state_t m_resid;
+    state_t m_residPrev;
+    state_t m_gPrev;
+    matrix_t m_residDiff;
+    matrix_t m_gDiff;
+    matrix_t m_gram;
+    Eigen::Matrix<scalar_t, -1, 1> m_rhs;
+    Eigen::Matrix<scalar_t, -1, 1> m_gamma;
+};
+
+template<class state_t>
+std::unique_ptr<InterfaceAcceleratorBase<state_t>>
+create_interface_accelerator(const InterfaceAccel type, const int depth, const double relax, const double omegaMax)
+{
+    switch (type)
+    {
+        case InterfaceAccel::Aitken:
+            return std::make_unique<AitkenAccelerator<state_t>>(relax, omegaMax);
+        case InterfaceAccel::Anderson:
+            return std::make_unique<AndersonAccelerator<state_t>>(depth, relax);
+        default:
+            return nullptr;
+    }
+}
+
+//
+// Predictor of the boundary state (m_stateBCs) of a single subdomain at the start of an
+// outer step, by polynomial extrapolation of the converged boundary states of the last
+// outer steps, assuming a fixed outer step size. Falls back to lower order while the
+// history fills up.
+//
+template<class state_t>
+class InterfacePredictor
+{
+public:
+    explicit InterfacePredictor(const int order)
+        : m_order(order)
+        , m_hist(order + 1)
+    {
+        if ((m_order < 1) || (m_order > 2)) throw std::runtime_error("Interface predictor order must be 1 or 2");
+    }
+
+    // forget the history, e.g. after a restart
+    void clear() { m_count = 0; }
+
+    // on entry stateBCs holds the converged boundary state of the last outer step,
+    //      which is overwritten with the prediction for the next one
+    void predict(state_t & stateBCs)
+    {
+        // m_hist[0] is the newest
+        std::rotate(m_hist.rbegin(), m_hist.rbegin() + 1, m_hist.rend());
+        m_hist[0] = stateBCs;
+        m_count = std::min(m_count + 1, m_order + 1);
+
+        if (m_count == 2) {
+            stateBCs = 2.0 * m_hist[0] - m_hist[1];
+        }
+        else if (m_count == 3) {
+            stateBCs = 3.0 * m_hist[0] - 3.0 * m_hist[1] + m_hist[2];
+        }
+    }
+
+private:
+    int m_order;
+    int m_count = 0;
+    std::vector<state_t> m_hist;
+};
+
+template<class state_t>
+std::unique_ptr<InterfacePredictor<state_t>>
+create_interface_predictor(const InterfacePredict type)
+{
+    switch (type)
+    {
+        case InterfacePredict::Linear:
+            return std::make_unique<InterfacePredictor<state_t>>(1);
+        case InterfacePredict::Quadratic:
+            return std::make_unique<InterfacePredictor<state_t>>(2);
+        default:
+            return nullptr;
+    }
+}
+
+}
+
+#endif
@@ -48,6 +48,7 @@
 
 #include "pressiodemoapps/impl/ghost_relative_locations.hpp"
 #include "pressiodemoapps/euler2d.hpp"
+#include "pressiodemoapps/euler3d.hpp"
 #include "pressiodemoapps/swe2d.hpp"
 #include "pressiodemoapps/advection_diffusion2d.hpp"
 
@@ -59,6 +60,7 @@ namespace pda = pressiodemoapps;
 enum class BCType {
     HomogNeumannVert,
     HomogNeumannHoriz,
+    HomogNeumannDepth,  // walls normal to z, 3D only
     HomogDirichletVert,
     HomogDirichletHoriz,
     SlipWallVert,
@@ -93,8 +95,22 @@ struct BCFunctor
         m_graphBcs = graphBcs;
     }
 
+    // 3D problems pass cellZ as well, to both the ghost filling and the Jacobian factor calls
     template<class ...Args>
     void operator()(Args && ... args) const
+    {
+        if constexpr ((sizeof...(Args) == 9) || (sizeof...(Args) == 6)) {
+            call3d(std::forward<Args>(args)...);
+        }
+        else {
+            call2d(std::forward<Args>(args)...);
+        }
+    }
+
+private:
+
+    template<class ...Args>
+    void call2d(Args && ... args) const
     {
         switch(m_bcSwitch)
         {
@@ -124,7 +140,28 @@ struct BCFunctor
         };
     }
 
-private:
+    // only homogeneous Neumann physical boundaries are implemented in 3D so far
+    template<class ...Args>
+    void call3d(Args && ... args) const
+    {
+        switch(m_bcSwitch)
+        {
+            case BCType::HomogNeumannVert:
+                HomogNeumann3dBC(0, 2, std::forward<Args>(args)...);
+                break;
+            case BCType::HomogNeumannHoriz:
+                HomogNeumann3dBC(3, 1, std::forward<Args>(args)...);
+                break;
+            case BCType::HomogNeumannDepth:
+                HomogNeumann3dBC(4, 5, std::forward<Args>(args)...);
+                break;
+            case BCType::SchwarzDirichlet:
+                SchwarzDirichletBC(std::forward<Args>(args)...);
+                break;
+            default:
+                throw std::runtime_error("BCType not implemented in 3D");
+        };
+    }
 
     /*=========================
         PHYSICAL BOUNDARIES
@@ -495,6 +532,70 @@ private:
         factorsForBCJac[2] = -1.0;
     }
 
+    // lowIdx/highIdx: neighbor indices of the two walls normal to the axis, in
+    //      3D connectivity order (left, front, right, back, bottom, top)
+    template<class ConnecRowType, class StateT, class T>
+    void HomogNeumann3dBC(
+        const int lowIdx, const int highIdx,
+        const int /*unused*/, ConnecRowType const & connectivityRow,
+        const double cellX, const double cellY, const double cellZ,
+        const StateT & currentState, int numDofPerCell,
+        const double cellWidth, T & ghostValues) const
+    {
+        // this operates under the assumption that this cell does not have ghost cells in two parallel walls
+        int stencilSize1D = ghostValues.cols() / numDofPerCell;
+        if (stencilSize1D > 2) {
+            throw std::runtime_error("HomogNeumann3dBC supports first order and WENO3 reconstructions only");
+        }
+        const int cellGID = connectivityRow[0];
+        const auto uIndex  = cellGID * numDofPerCell;
+
+        const auto low0  = connectivityRow[1 + lowIdx];
+        const auto high0  = connectivityRow[1 + highIdx];
+        if ((low0 == -1) && (high0 == -1)) {
+            throw std::runtime_error("Should not have walls on both sides of same cell");
+        }
+
+        if ((low0 == -1) || (high0 == -1)) {
+            for (int i = 0; i < numDofPerCell; ++i) {
+                ghostValues[i] = currentState(uIndex+i);
+            }
+        }
+
+        if (stencilSize1D > 1) {
+            const auto low1  = connectivityRow[7 + lowIdx];
+            const auto high1  = connectivityRow[7 + highIdx];
+            if ((low1 == -1) && (high1 == -1)) {
+                throw std::runtime_error("Should not have walls on both sides of same cell");
+            }
+
+            if (low1 == -1) {
+                const auto ind = high0*numDofPerCell;
+                for (int i = 0; i < numDofPerCell; ++i) {
+                    ghostValues[numDofPerCell + i] = currentState(ind+i);
+                }
+            }
+            if (high1 == -1) {
+                const auto ind = low0*numDofPerCell;
+                for (int i = 0; i < numDofPerCell; ++i) {
+                    ghostValues[numDofPerCell + i] = currentState(ind+i);
+                }
+            }
+        }
+    }
+
+    template<class ConnecRowType, class FactorsType>
+    void HomogNeumann3dBC(
+        const int /*lowIdx*/, const int /*highIdx*/,
+        ConnecRowType const & connectivityRow,
+        const double cellX, const double cellY, const double cellZ,
+        int numDofPerCell, FactorsType & factorsForBCJac) const
+    {
+        for (int i = 0; i < numDofPerCell; ++i) {
+            factorsForBCJac[i] = 1.0;
+        }
+    }
+
     /*=========================
         SCHWARZ BOUNDARIES
     =========================*/
@@ -538,6 +639,26 @@ private:
         }
     }
 
+    // 3D, ghost values are located through m_graphBcs only, so cellZ is not needed
+    template<class ConnecRowType, class StateT, class T>
+    void SchwarzDirichletBC(
+        const int gRow, ConnecRowType const & connectivityRow,
+        const double cellX, const double cellY, const double /*cellZ*/,
+        const StateT & currentState, int numDofPerCell,
+        const double cellWidth, T & ghostValues) const
+    {
+        SchwarzDirichletBC(gRow, connectivityRow, cellX, cellY, currentState, numDofPerCell, cellWidth, ghostValues);
+    }
+
+    template<class ConnecRowType, class FactorsType>
+    void SchwarzDirichletBC(
+        ConnecRowType const & connectivityRow,
+        const double cellX, const double cellY, const double /*cellZ*/,
+        int numDofPerCell, FactorsType & factorsForBCJac) const
+    {
+        SchwarzDirichletBC(connectivityRow, cellX, cellY, numDofPerCell, factorsForBCJac);
+    }
+
 };
 
 /*============================
@@ -568,6 +689,33 @@ auto getPhysBCs(pda::Euler2d probId, pda::impl::GhostRelativeLocation rloc)
     }
 }
 
+auto getPhysBCs(pda::Euler3d probId, pda::impl::GhostRelativeLocation rloc)
+{
+
+    switch(probId)
+    {
+        case pda::Euler3d::Riemann:
+            // All boundaries are homogeneous Neumann
+            if ((rloc == pda::impl::GhostRelativeLocation::Left) || (rloc == pda::impl::GhostRelativeLocation::Right)) {
+                return BCType::HomogNeumannVert;
+            }
+            else if ((rloc == pda::impl::GhostRelativeLocation::Front) || (rloc == pda::impl::GhostRelativeLocation::Back)) {
+                return BCType::HomogNeumannHoriz;
+            }
+            else if ((rloc == pda::impl::GhostRelativeLocation::Bottom) || (rloc == pda::impl::GhostRelativeLocation::Top)) {
+                return BCType::HomogNeumannDepth;
+            }
+            else {
+                throw std::runtime_error("Unexpected GhostRelativeLocation");
+            }
+            break;
+
+        default:
+            throw std::runtime_error("Invalid probId for getPhysBCs()");
+
+    }
+}
+
 auto getPhysBCs(pda::Swe2d probId, pda::impl::GhostRelativeLocation rloc)
 {
 
@@ -0,0 +1,289 @@
+//@HEADER
+// ************************************************************************
+//
+//                     		       Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Chris Wentland (crwentl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PRESSIODEMOAPPS_SCHWARZ_INSTRUMENTATION_HPP_
+#define PRESSIODEMOAPPS_SCHWARZ_INSTRUMENTATION_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace pschwarz{
+
+//
+// iteration counts and time spent in the linear solver of one subdomain
+// every Newton / Gauss-Newton iteration performs exactly one linear solve
+//
+struct SolverStats
+{
+    std::uint64_t m_solves = 0;
+    std::uint64_t m_iterations = 0;  // inner iterations of iterative linear solvers
+    double m_seconds = 0.0;
+
+    SolverStats operator-(const SolverStats & other) const {
+        return {m_solves - other.m_solves, m_iterations - other.m_iterations, m_seconds - other.m_seconds};
+    }
+};
+
+template<class T, class = void>
+struct has_num_iterations : std::false_type {};
+
+template<class T>
+struct has_num_iterations<T, std::void_t<decltype(std::declval<const T &>().numIterationsExecuted())>>
+    : std::true_type {};
+
+//
+// drop-in for a pressio linear solver, counting and timing its solves
+//
+template<class solver_t>
+class CountingLinearSolver : public solver_t
+{
+public:
+    using solver_t::solver_t;
+
+    template<class A_t, class b_t, class x_t>
+    void solve(const A_t & A, const b_t & b, x_t & x)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        solver_t::solve(A, b, x);
+        m_stats.m_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        m_stats.m_solves++;
+        if constexpr (has_num_iterations<solver_t>::value) {
+            m_stats.m_iterations += static_cast<std::uint64_t>(this->numIterationsExecuted());
+        }
+    }
+
+    const SolverStats & stats() const { return m_stats; }
+
+private:
+    SolverStats m_stats;
+};
+
+enum class Phase{ Step, LinearSolve, UpdateFullState, Convergence, StoreHistory, ResetHistory, Accelerate, Broadcast, Predict };
+constexpr int phase_count = 9;
+constexpr std::array<const char *, phase_count> phase_names = {
+    "step", "linear solve", "update full state", "convergence",
+    "store history", "reset history", "accelerate", "broadcast", "predict"
+};
+
+//
+// per-subdomain, per-phase timers of the Schwarz iteration
+// each subdomain's records are only touched by the thread currently working on that
+//      subdomain, so recording needs no synchronization
+//
+class Instrumentation
+{
+public:
+    using clock_t = std::chrono::steady_clock;
+
+    struct TraceEvent
+    {
+        Phase m_phase;
+        std::int64_t m_startNs;
+        std::int64_t m_durationNs;
+        std::int64_t m_count;  // linear solves within a step, -1 otherwise
+    };
+
+    struct DomainRecord
+    {
+        std::array<double, phase_count> m_seconds = {};
+        std::array<std::uint64_t, phase_count> m_calls = {};
+        std::uint64_t m_linearIters = 0;
+        std::vector<TraceEvent> m_events;
+    };
+
+    Instrumentation(const int ndomains, const bool trace)
+        : m_trace(trace)
+        , m_epoch(clock_t::now())
+        , m_records(ndomains)
+    {}
+
+    bool tracing() const { return m_trace; }
+    const DomainRecord & record(const int domIdx) const { return m_records[domIdx]; }
+
+    void add(const int domIdx, const Phase phase,
+             const clock_t::time_point start, const clock_t::time_point end,
+             const std::int64_t count = -1)
+    {
+        auto & rec = m_records[domIdx];
+        const auto idx = static_cast<int>(phase);
+        rec.m_seconds[idx] += std::chrono::duration<double>(end - start).count();
+        rec.m_calls[idx]++;
+        if (m_trace) {
+            rec.m_events.push_back({phase, ns_since_epoch(start),
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), count});
+        }
+    }
+
+    // linear solves are timed by the solver itself, and only accumulated
+    // they run inside a step, so their time is moved out of it and the table's phases stay exclusive
+    void add_solver_stats(const int domIdx, const SolverStats & delta)
+    {
+        auto & rec = m_records[domIdx];
+        const auto idx = static_cast<int>(Phase::LinearSolve);
+        rec.m_seconds[idx] += delta.m_seconds;
+        rec.m_seconds[static_cast<int>(Phase::Step)] -= delta.m_seconds;
+        rec.m_calls[idx] += delta.m_solves;
+        rec.m_linearIters += delta.m_iterations;
+    }
+
+    void reset()
+    {
+        for (auto & rec : m_records) {
+            rec = DomainRecord{};
+        }
+        m_epoch = clock_t::now();
+    }
+
+    // Chrome trace event format (chrome://tracing, Perfetto), one row per subdomain
+    void write_chrome_trace(const std::string & fileName) const
+    {
+        std::ofstream out(fileName);
+        if (!out) {
+            throw std::runtime_error("Could not open trace file " + fileName);
+        }
+        out << std::fixed << std::setprecision(3);  // microseconds, long runs exceed the default precision
+        out << "{\"traceEvents\":[\n";
+        bool first = true;
+        for (std::size_t domIdx = 0; domIdx < m_records.size(); ++domIdx) {
+            out << (first ? "" : ",\n")
+                << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << domIdx
+                << ",\"args\":{\"name\":\"subdomain " << domIdx << "\"}}";
+            first = false;
+            for (const auto & event : m_records[domIdx].m_events) {
+                out << ",\n{\"name\":\"" << phase_names[static_cast<int>(event.m_phase)]
+                    << "\",\"cat\":\"schwarz\",\"ph\":\"X\",\"pid\":0,\"tid\":" << domIdx
+                    << ",\"ts\":" << event.m_startNs * 1e-3
+                    << ",\"dur\":" << event.m_durationNs * 1e-3;
+                if (event.m_count >= 0) {
+                    out << ",\"args\":{\"linear solves\":" << event.m_count << "}";
+                }
+                out << "}";
+            }
+        }
+        out << "\n]}\n";
+    }
+
+    // aggregate table, read by pschwarz.data_utils.read_runtimes
+    // seconds are exclusive, step excludes its linear solves (trace events are inclusive spans)
+    // header: magic, ndomains, nphases, nphases 32-byte phase names
+    // per subdomain: nphases seconds (f64), nphases call counts (u64), linear solver iterations (u64)
+    void write_table(const std::string & fileName) const
+    {
+        std::ofstream out(fileName, std::ios::out | std::ios::binary);
+        if (!out) {
+            throw std::runtime_error("Could not open instrumentation table " + fileName);
+        }
+        const std::uint64_t ndomains = m_records.size();
+        const std::uint64_t nphases = phase_count;
+        out.write(table_magic, 8);
+        out.write(reinterpret_cast<const char *>(&ndomains), sizeof(ndomains));
+        out.write(reinterpret_cast<const char *>(&nphases), sizeof(nphases));
+        for (const auto name : phase_names) {
+            char padded[32] = {};
+            std::strncpy(padded, name, sizeof(padded) - 1);
+            out.write(padded, sizeof(padded));
+        }
+        for (const auto & rec : m_records) {
+            out.write(reinterpret_cast<const char *>(rec.m_seconds.data()), phase_count * sizeof(double));
+            out.write(reinterpret_cast<const char *>(rec.m_calls.data()), phase_count * sizeof(std::uint64_t));
+            out.write(reinterpret_cast<const char *>(&rec.m_linearIters), sizeof(std::uint64_t));
+        }
+    }
+
+    static constexpr const char * table_magic = "PSCHWPH1";
+
+private:
+    std::int64_t ns_since_epoch(const clock_t::time_point t) const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(t - m_epoch).count();
+    }
+
+    bool m_trace;
+    clock_t::time_point m_epoch;
+    std::vector<DomainRecord> m_records;
+};
+
+//
+// times the enclosing scope as one phase of a subdomain, noop without instrumentation
+//
+class PhaseTimer
+{
+public:
+    PhaseTimer(Instrumentation * instr, const int domIdx, const Phase phase)
+        : m_instr(instr), m_domIdx(domIdx), m_phase(phase)
+    {
+        if (m_instr) { m_start = Instrumentation::clock_t::now(); }
+    }
+
+    ~PhaseTimer()
+    {
+        if (m_instr) { m_instr->add(m_domIdx, m_phase, m_start, Instrumentation::clock_t::now(), m_count); }
+    }
+
+    PhaseTimer(const PhaseTimer &) = delete;
+    PhaseTimer & operator=(const PhaseTimer &) = delete;
+
+    void set_count(const std::int64_t count) { m_count = count; }
+
+private:
+    Instrumentation * m_instr;
+    int m_domIdx;
+    Phase m_phase;
+    std::int64_t m_count = -1;
+    Instrumentation::clock_t::time_point m_start;
+};
+
+}
+
+#endif
@@ -54,6 +54,17 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "Eigen/Dense"
 
 
@@ -116,6 +127,97 @@ auto read_vector_from_binary(const std::string & fileName) {
     return V;
 }
 
+// Read-only memory mapping of a binary matrix file, same layout as read_matrix_from_binary.
+// Pages are only faulted in when touched (so only the leading columns of a basis are read),
+// and are shared through the page cache with every other mapping of the file on the node.
+template<class ScalarType>
+class MappedBinaryMatrix
+{
+    static constexpr std::size_t m_headerBytes = 2 * sizeof(std::size_t);
+
+public:
+    using matrix_map_t = Eigen::Map<const Eigen::Matrix<ScalarType, -1, -1, Eigen::ColMajor>>;
+    using vector_map_t = Eigen::Map<const Eigen::Matrix<ScalarType, -1, 1>>;
+
+    explicit MappedBinaryMatrix(const std::string & fileName)
+    {
+        checkfile(fileName);
+
+        const int fd = ::open(fileName.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw std::runtime_error("Cannot open " + fileName + ": " + strerror(errno));
+        }
+        struct stat sb;
+        if ((::fstat(fd, &sb) == -1) || (static_cast<std::size_t>(sb.st_size) < m_headerBytes)) {
+            ::close(fd);
+            throw std::runtime_error("Invalid binary file: " + fileName);
+        }
+        m_bytes = sb.st_size;
+        m_addr = ::mmap(nullptr, m_bytes, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (m_addr == MAP_FAILED) {
+            throw std::runtime_error("Cannot mmap " + fileName + ": " + strerror(errno));
+        }
+
+        const auto header = static_cast<const std::size_t *>(m_addr);
+        m_rows = header[0];
+        m_cols = header[1];
+        if (m_headerBytes + m_rows * m_cols * sizeof(ScalarType) > m_bytes) {
+            ::munmap(m_addr, m_bytes);
+            throw std::runtime_error("Truncated binary file: " + fileName);
+        }
+    }
+
+    ~MappedBinaryMatrix() { ::munmap(m_addr, m_bytes); }
+
+    MappedBinaryMatrix(const MappedBinaryMatrix &) = delete;
+    MappedBinaryMatrix & operator=(const MappedBinaryMatrix &) = delete;
+
+    std::size_t rows() const { return m_rows; }
+    std::size_t cols() const { return m_cols; }
+
+    // view of the leading numCols columns
+    matrix_map_t matrix(const int numCols) const
+    {
+        if ((numCols < 0) || (static_cast<std::size_t>(numCols) > m_cols)) {
+            throw std::runtime_error("Requested " + std::to_string(numCols) +
+                " columns from binary file with " + std::to_string(m_cols));
+        }
+        ::madvise(m_addr, m_headerBytes + m_rows * numCols * sizeof(ScalarType), MADV_WILLNEED);
+        return matrix_map_t(data(), m_rows, numCols);
+    }
+
+    // view of the first column
+    vector_map_t vector() const { return vector_map_t(data(), m_rows); }
+
+private:
+    const ScalarType * data() const {
+        return reinterpret_cast<const ScalarType *>(static_cast<const char *>(m_addr) + m_headerBytes);
+    }
+
+    void * m_addr = nullptr;
+    std::size_t m_bytes = {};
+    std::size_t m_rows = {};
+    std::size_t m_cols = {};
+};
+
+// Process-wide store of file mappings, every consumer of the same file shares a single mapping.
+// A mapping is released once the last consumer lets go of it.
+template<class ScalarType>
+std::shared_ptr<const MappedBinaryMatrix<ScalarType>> map_binary_file(const std::string & fileName)
+{
+    static std::mutex storeMutex;
+    static std::unordered_map<std::string, std::weak_ptr<const MappedBinaryMatrix<ScalarType>>> store;
+
+    std::lock_guard<std::mutex> lock(storeMutex);
+    auto mapped = store[fileName].lock();
+    if (!mapped) {
+        mapped = std::make_shared<const MappedBinaryMatrix<ScalarType>>(fileName);
+        store[fileName] = mapped;
+    }
+    return mapped;
+}
+
 // TODO: adjust I/O naming conventions to reflect return type
 template<class ScalarType>
 auto read_vector_from_ascii(const std::string & fileName)
@@ -191,14 +293,30 @@ struct HypRedUpdater
     int numDofsPerCell_ = {};
 
     explicit HypRedUpdater(const int numDofsPerCell, const std::string & stfile, const std::string & safile)
+        : HypRedUpdater(numDofsPerCell,
+                        create_cell_gids_vector_and_fill_from_ascii(stfile),
+                        create_cell_gids_vector_and_fill_from_ascii(safile))
+    {}
+
+    template<class GidsType>
+    HypRedUpdater(const int numDofsPerCell, const GidsType & stencilMeshGids, const GidsType & sampleMeshGids)
         : numDofsPerCell_(numDofsPerCell)
     {
-        const auto stencilMeshGids = create_cell_gids_vector_and_fill_from_ascii(stfile);
-        const auto sampleMeshGids  = create_cell_gids_vector_and_fill_from_ascii(safile);
+        // stencil GIDs generated at runtime are sorted, allowing a binary search
+        const auto stBegin = stencilMeshGids.data();
+        const auto stEnd = stencilMeshGids.data() + stencilMeshGids.size();
+        const bool sorted = std::is_sorted(stBegin, stEnd);
 
         indices_.resize(sampleMeshGids.size());
         for (std::size_t i = 0; i < indices_.size(); ++i) {
-            const auto index = find_index<int>(stencilMeshGids, sampleMeshGids[i]);
+            int index;
+            if (sorted) {
+                const auto it = std::lower_bound(stBegin, stEnd, sampleMeshGids[i]);
+                index = ((it != stEnd) && (*it == sampleMeshGids[i])) ? int(it - stBegin) : std::numeric_limits<int>::max();
+            }
+            else {
+                index = find_index<int>(stencilMeshGids, sampleMeshGids[i]);
+            }
             assert(index != std::numeric_limits<int>::max());
             indices_[i] = index;
         }
@@ -253,9 +371,20 @@ auto create_hyper_updater(
 
 }
 
+template<class mesh_t, class GidsType>
+auto create_hyper_updater(
+    const int numDofsPerCell,
+    const GidsType & stencilGids,
+    const GidsType & sampleGids)
+{
+    using scalar_type = typename mesh_t::scalar_t;
+    using return_type = HypRedUpdater<scalar_type>;
+    return return_type(numDofsPerCell, stencilGids, sampleGids);
+}
+
 // extract stencil mesh values from full-order matrix
 // rows are unrolled state vector, columns are basis/snapshot/etc. vectors
-// OperandType should really be an Eigen::Matrix
+// OperandType should really be an Eigen::Matrix (or a Map of one)
 template<class OperandType, class CellGidsVectorType>
 auto reduce_matrix_on_stencil_mesh(
     const OperandType & operand,
@@ -264,7 +393,7 @@ auto reduce_matrix_on_stencil_mesh(
 {
 
     const auto totStencilDofs = stencilMeshGids.size() * numDofsPerCell;
-    OperandType result(totStencilDofs, operand.cols());
+    Eigen::Matrix<typename OperandType::Scalar, -1, -1, Eigen::ColMajor> result(totStencilDofs, operand.cols());
     for (int i = 0; i < stencilMeshGids.size(); ++i) {
         for (int k = 0; k < numDofsPerCell; ++k){
             const int row = i * numDofsPerCell + k;
@@ -278,7 +407,7 @@ auto reduce_matrix_on_stencil_mesh(
 }
 
 // extract stencil mesh values from full-order vector
-// OperandType should really be an Eigen::Vector
+// OperandType should really be an Eigen::Vector (or a Map of one)
 template<class OperandType, class CellGidsVectorType>
 auto reduce_vector_on_stencil_mesh(
     const OperandType & operand,
@@ -287,7 +416,7 @@ auto reduce_vector_on_stencil_mesh(
 {
 
     const auto totStencilDofs = stencilMeshGids.size() * numDofsPerCell;
-    OperandType result(totStencilDofs);
+    Eigen::Matrix<typename OperandType::Scalar, -1, 1> result(totStencilDofs);
     for (int i = 0; i < stencilMeshGids.size(); ++i) {
         for (int k = 0; k < numDofsPerCell; ++k) {
             const int row = i * numDofsPerCell + k;
@@ -328,8 +457,8 @@ public:
             leading_dim = nmodes;
 
             // compute Z * Phi
-            auto basis_gpod = pschwarz::read_matrix_from_binary<scalar_t>(basisfile, nmodes);
-            auto basis_sample = pschwarz::reduce_matrix_on_stencil_mesh(basis_gpod, sampleGids, numDofsPerCell);
+            const auto basis_gpod = pschwarz::map_binary_file<scalar_t>(basisfile);
+            auto basis_sample = pschwarz::reduce_matrix_on_stencil_mesh(basis_gpod->matrix(nmodes), sampleGids, numDofsPerCell);
 
             // size matrices
             std::size_t numsamps = sampleGids.rows();
@@ -49,7 +49,9 @@
 #include "BS_thread_pool.hpp"
 #include "pressio/ode_steppers.hpp"
 #include "pressiodemoapps/impl/ghost_relative_locations.hpp"
+#include "./accelerators.hpp"
 #include "./custom_bcs.hpp"
+#include "./instrumentation.hpp"
 #include "./subdomain.hpp"
 #include "./tiling.hpp"
 #include <string>
@@ -58,9 +60,21 @@
 #include <fstream>
 #include <sstream>
 #include <sys/stat.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
 #include <iomanip>
 #include <filesystem>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <exception>
+#include <numeric>
+#include <algorithm>
 
 
 namespace pschwarz {
@@ -82,6 +96,21 @@ using euler2d_app_type =
             std::unordered_map<std::string, typename mesh_t::scalar_type>() /* user parameters */
         )
     );
+using euler3d_app_type =
+    decltype(pda::create_problem_eigen(
+            std::declval<mesh_t>(),
+            std::declval<pda::Euler3d>(),
+            std::declval<pda::InviscidFluxReconstruction>(),
+            std::declval<BCFunctor<mesh_t>>(),
+            std::declval<BCFunctor<mesh_t>>(),
+            std::declval<BCFunctor<mesh_t>>(),
+            std::declval<BCFunctor<mesh_t>>(),
+            std::declval<BCFunctor<mesh_t>>(),
+            std::declval<BCFunctor<mesh_t>>(),
+            int(), /* initial condition */
+            std::unordered_map<std::string, typename mesh_t::scalar_type>() /* user parameters */
+        )
+    );
 using swe2d_app_type =
     decltype(pda::create_problem_eigen(
             std::declval<mesh_t>(),
@@ -114,7 +143,113 @@ struct Errors{
     double m_absolute = {};
 };
 
-enum class SchwarzMode{ Multiplicative, Additive };
+enum class SchwarzMode{ Multiplicative, Additive, MultiplicativeColored, Asynchronous };
+
+// FullState: change of the whole subdomain state between Schwarz iterations
+// Interface: change of the states broadcast to neighbors only, worst over variables
+enum class ConvergenceMetric{ FullState, Interface };
+
+// reduction of subdomain errors into the Schwarz convergence check
+enum class ErrorReduction{ Average, Max };
+
+//
+// CSR exchange plan of one sending subdomain: entries sent to neighbor neighIdx are
+// [m_offsets[neighIdx], m_offsets[neighIdx + 1]), m_source indexes the sender's stencil state
+// and m_target the receiver's m_stateBCs, both pre-scaled by the number of dofs per cell
+//
+struct ExchangePlan
+{
+    std::vector<int> m_offsets;
+    std::vector<int> m_source;
+    std::vector<int> m_target;
+};
+
+// copies count cell blocks from src + srcIdx[i] to dst + dstIdx[i]
+// a null index array denotes contiguous blocks, N > 0 fixes the block size at compile time
+template<int N, class scalar_t>
+void copy_cell_blocks(const scalar_t * src, const int * srcIdx,
+                      scalar_t * dst, const int * dstIdx,
+                      const int count, const int dofPerCell)
+{
+    const int blockSize = (N > 0) ? N : dofPerCell;
+    for (int i = 0; i < count; ++i) {
+        const scalar_t * srcBlock = src + (srcIdx ? srcIdx[i] : i * blockSize);
+        scalar_t * dstBlock = dst + (dstIdx ? dstIdx[i] : i * blockSize);
+        for (int dofIdx = 0; dofIdx < blockSize; ++dofIdx) {
+            dstBlock[dofIdx] = srcBlock[dofIdx];
+        }
+    }
+}
+
+//
+// versioned boundary data sent from one subdomain to one of its neighbors,
+// used by asynchronous Schwarz in place of writing directly into the neighbor's m_stateBCs
+//
+struct InterfaceBuffer
+{
+    std::mutex m_mutex;
+    std::vector<double> m_data;
+    std::atomic<long> m_version{0};   // bumped by the sending subdomain on each publish
+    std::atomic<long> m_consumed{0};  // last version copied by the receiving subdomain
+};
+
+//
+// checkpoint file layout: CheckpointHeader, one CheckpointEntry per subdomain,
+// then per subdomain the stencil state, reduced state (ROMs only), and m_stateBCs,
+// each stored contiguously at m_offset so that subdomains can be written/read independently
+//
+struct CheckpointHeader
+{
+    char m_magic[8] = {'P', 'S', 'C', 'H', 'W', 'C', 'K', 'P'};
+    std::uint64_t m_version = 1;
+    std::uint64_t m_scalarBytes = {};
+    std::uint64_t m_ndomains = {};
+    std::int64_t m_outerStep = {};
+    double m_time = {};
+};
+
+struct CheckpointEntry
+{
+    std::uint64_t m_controlIters = {};
+    std::uint64_t m_stepCount = {};   // subdomain time steps taken, outerStep * m_controlIters
+    std::uint64_t m_stencilSize = {};
+    std::uint64_t m_reducedSize = {};
+    std::uint64_t m_bcSize = {};
+    std::uint64_t m_offset = {};      // bytes from start of file
+};
+
+inline void pwrite_all(const int fd, const void * buf, std::size_t bytes, off_t offset)
+{
+    auto ptr = static_cast<const char *>(buf);
+    while (bytes > 0) {
+        const auto written = ::pwrite(fd, ptr, bytes, offset);
+        if (written < 0) {
+            if (errno == EINTR) { continue; }
+            throw std::runtime_error(std::string("Checkpoint write failed: ") + strerror(errno));
+        }
+        ptr += written;
+        bytes -= written;
+        offset += written;
+    }
+}
+
+inline void pread_all(const int fd, void * buf, std::size_t bytes, off_t offset)
+{
+    auto ptr = static_cast<char *>(buf);
+    while (bytes > 0) {
+        const auto nread = ::pread(fd, ptr, bytes, offset);
+        if (nread < 0) {
+            if (errno == EINTR) { continue; }
+            throw std::runtime_error(std::string("Checkpoint read failed: ") + strerror(errno));
+        }
+        if (nread == 0) {
+            throw std::runtime_error("Checkpoint file is truncated");
+        }
+        ptr += nread;
+        bytes -= nread;
+        offset += nread;
+    }
+}
 
 template<class ...SubdomainArgs>
 class SchwarzDecomp
@@ -130,46 +265,165 @@ public:
                 std::vector<double> & dtVec)
         : m_tiling(tiling)
         , m_subdomainVec(subdomains)
+        , m_ownedVec(tiling->count(), 1)
+    {
+        setup(dtVec);
+    }
+
+    // per-domain setup phases are distributed over the thread pool
+    SchwarzDecomp(std::vector<std::shared_ptr< subdomain_base_t >> & subdomains,
+                std::shared_ptr<const Tiling> tiling,
+                std::vector<double> & dtVec,
+                BS::thread_pool & pool)
+        : m_tiling(tiling)
+        , m_subdomainVec(subdomains)
+        , m_ownedVec(tiling->count(), 1)
+        , m_setupPool(&pool)
+    {
+        setup(dtVec);
+        m_setupPool = nullptr;
+    }
+
+    void print_setup_times() const
+    {
+        std::cout << "Schwarz setup times (s):\n";
+        for (const auto & [phase, secs] : m_setupTimes) {
+            std::cout << "  " << std::left << std::setw(40) << phase << secs << "\n";
+        }
+    }
+
+protected:
+
+    // only the subdomains flagged in ownedVec are set up for solving, the others only
+    //      contribute their interface connectivity, and may be SubdomainInterface stand-ins
+    SchwarzDecomp(std::vector<std::shared_ptr< subdomain_base_t >> & subdomains,
+                std::shared_ptr<const Tiling> tiling,
+                std::vector<double> & dtVec,
+                std::vector<char> ownedVec)
+        : m_tiling(tiling)
+        , m_subdomainVec(subdomains)
+        , m_ownedVec(std::move(ownedVec))
+    {
+        if (m_ownedVec.size() != (size_t) tiling->count()) {
+            throw std::runtime_error("Incorrect number of ownership flags");
+        }
+        setup(dtVec);
+    }
+
+    void setup(std::vector<double> & dtVec)
     {
-        m_dofPerCell = m_subdomainVec[0]->getDofPerCell();
+        const auto firstOwned = std::find(m_ownedVec.begin(), m_ownedVec.end(), 1);
+        if (firstOwned == m_ownedVec.end()) {
+            throw std::runtime_error("SchwarzDecomp needs at least one owned subdomain");
+        }
+        m_dofPerCell = m_subdomainVec[firstOwned - m_ownedVec.begin()]->getDofPerCell();
+        auto phaseStart = std::chrono::steady_clock::now();
 
-        // silly, but some things have to be written to disk for hyper-reduction,
+        // silly, but hyper-reduced stencil meshes have to be written to disk,
         //      as mesh class HAS to be instantiated from a mesh directory
-        m_tempdir = "./temp_" + std::to_string(::getpid());
-        std::filesystem::create_directory(m_tempdir);
+        m_tempdir = scratch_root() + "/temp_" + std::to_string(::getpid());
+        std::filesystem::create_directories(m_tempdir);
 
         // set up connectivity for neighboring subdomains
         // only relevant if at least one domain is a hyper-reduction subdomain
         calc_hyper_connectivity();
+        phaseStart = std::chrono::steady_clock::now();
 
         // hyper-reduction subdomains need some final member object initializations
         // this is a consequence of computing the stencil mesh at runtime
-        for (int domIdx = 0; domIdx < m_subdomainVec.size(); ++domIdx) {
+        for_each_owned_domain([&](const int domIdx) {
             m_subdomainVec[domIdx]->finalize_subdomain(m_tempdir);
-        }
+        });
+        record_setup_time("finalize subdomains", phaseStart);
 
         setup_controller(dtVec);
-        for (int domIdx = 0; domIdx < m_subdomainVec.size(); ++domIdx) {
+        init_domain_costs();
+        for_each_owned_domain([&](const int domIdx) {
             m_subdomainVec[domIdx]->allocateStorageForHistory(m_controlItersVec[domIdx]);
-        }
+        });
+        record_setup_time("controller and history", phaseStart);
 
         // set up communication patterns, first communication
         calc_exch_graph();
-        for (int domIdx = 0; domIdx < m_subdomainVec.size(); ++domIdx) {
+        record_setup_time("exchange graph", phaseStart);
+        for_each_owned_domain([&](const int domIdx) {
             broadcast_bcState(domIdx);
-        }
+        });
+        for_each_owned_domain([&](const int domIdx) {
+            *m_subdomainVec[domIdx]->getStateBCsBack() = *m_subdomainVec[domIdx]->getStateBCs();
+        });
+        record_setup_time("first broadcast", phaseStart);
 
         // set up ghost filling graph, boundary pointers
         calc_ghost_graph();
 
+        // interface buffers for asynchronous Schwarz
+        calc_interface_buffers();
+        record_setup_time("ghost graph and buffers", phaseStart);
+
 #ifndef SCHWARZ_SAVE_TEMPDIR
         // delete temporary directory
         std::filesystem::remove_all(m_tempdir);
 #endif
+    }
+
+    // runs f(domIdx) for every subdomain, on the setup thread pool if one was given
+    template<class F>
+    void for_each_domain(F && f)
+    {
+        for_each_domain(m_setupPool, std::forward<F>(f));
+    }
+
+    template<class F>
+    void for_each_owned_domain(F && f)
+    {
+        for_each_domain([&](const int domIdx) {
+            if (m_ownedVec[domIdx]) {
+                f(domIdx);
+            }
+        });
+    }
+
+    template<class F>
+    void for_each_domain(BS::thread_pool * pool, F && f)
+    {
+        const int ndomains = m_tiling->count();
+        if (pool) {
+            // futures instead of detached tasks, which terminate the process on exceptions
+            // all tasks finish before the first exception is rethrown, as they reference f
+            auto futures = pool->submit_loop<int>(0, ndomains, f);
+            futures.wait();
+            futures.get();
+        }
+        else {
+            for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+                f(domIdx);
+            }
+        }
+    }
 
+    // records the time since phaseStart, and restarts it
+    void record_setup_time(const std::string & phase,
+                           std::chrono::steady_clock::time_point & phaseStart)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        m_setupTimes.emplace_back(phase, std::chrono::duration<double>(now - phaseStart).count());
+        phaseStart = now;
     }
 
-private:
+    static std::string scratch_root()
+    {
+#ifdef SCHWARZ_SAVE_TEMPDIR
+        // kept in the working directory for post-processing
+        return ".";
+#else
+        // node-local, preferably memory-backed, scratch
+        if (std::filesystem::is_directory("/dev/shm")) {
+            return "/dev/shm";
+        }
+        return std::filesystem::temp_directory_path().string();
+#endif
+    }
 
     void setup_controller(std::vector<double> & dtVec)
     {
@@ -203,6 +457,66 @@ private:
         }
     }
 
+    // prior for the relative cost of one Schwarz iteration of each subdomain, until measured:
+    //      controller steps times the number of cells the subdomain's residual is evaluated on
+    void init_domain_costs()
+    {
+        const int ndomains = m_tiling->count();
+        m_domainCostVec.resize(ndomains);
+        m_allDomIds.resize(ndomains);
+        std::iota(m_allDomIds.begin(), m_allDomIds.end(), 0);
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            m_domainCostVec[domIdx] = 1e-9 * m_controlItersVec[domIdx] *
+                m_subdomainVec[domIdx]->getSampleGids()->rows();
+        }
+    }
+
+    // domIds sorted by decreasing estimated cost (longest processing time first)
+    const std::vector<int> & longest_first(const std::vector<int> & domIds)
+    {
+        m_scheduleOrder.assign(domIds.begin(), domIds.end());
+        std::stable_sort(m_scheduleOrder.begin(), m_scheduleOrder.end(), [this](const int a, const int b) {
+            return m_domainCostVec[a] > m_domainCostVec[b];
+        });
+        return m_scheduleOrder;
+    }
+
+    // exponential moving average of the measured runtime of solved subdomains
+    void update_domain_cost(const int domIdx, const double secs)
+    {
+        m_domainCostVec[domIdx] += m_costWeight * (secs - m_domainCostVec[domIdx]);
+    }
+
+    // domainIterate, feeding the runtime of solved subdomains into their estimated cost
+    bool timed_iterate(int domIdx, double currentTime, int outerStep, int convergeStep, Errors & errors)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const bool active = domainIterate(domIdx, currentTime, outerStep, convergeStep, errors);
+        if (active) {
+            update_domain_cost(domIdx, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+        return active;
+    }
+
+    // one Schwarz iteration of the subdomains in domIds, one task per subdomain, most expensive first
+    // finish(domIdx) is called by the task once the subdomain is done, frozen or not
+    template<class errs_t, class F>
+    void run_schwarz_iteration(BS::thread_pool & pool, const std::vector<int> & domIds,
+                               double currentTime, int outerStep, int convergeStep,
+                               errs_t & errs, std::vector<char> & active, F && finish)
+    {
+        BS::multi_future<void> futures;
+        for (const int domIdx : longest_first(domIds)) {
+            futures.push_back(pool.submit_task([&, domIdx] {
+                active[domIdx] = timed_iterate(domIdx, currentTime, outerStep, convergeStep, errs(domIdx, 0));
+                finish(domIdx);
+            }));
+        }
+        // see for_each_domain
+        futures.wait();
+        futures.get();
+    }
+
     int grid_to_linear_idx(int i, int j, int k) {
         const auto & tiling = *m_tiling;
         return i + j * tiling.countX() + k * tiling.countX() * tiling.countY();
@@ -211,11 +525,25 @@ private:
     auto linear_to_grid_idx(int domIdx) {
         const auto & tiling = *m_tiling;
         int i = domIdx % tiling.countX();
-        int j = domIdx / tiling.countX();
+        int j = (domIdx / tiling.countX()) % tiling.countY();
         int k = domIdx / (tiling.countX() * tiling.countY());
         return std::tuple(i, j, k);
     }
 
+    // the stencil mesh of a subdomain is read by itself and its neighbors
+    bool needs_stencil_mesh(const int domIdx) const
+    {
+        if (m_ownedVec[domIdx]) {
+            return true;
+        }
+        for (const auto neighDomIdx : m_tiling->exchDomIdVec()[domIdx]) {
+            if ((neighDomIdx != -1) && m_ownedVec[neighDomIdx]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void calc_hyper_connectivity()
     {
         const auto & tiling = *m_tiling;
@@ -225,12 +553,15 @@ private:
         std::vector<std::vector<int>> stencil_gids;
         std::vector<graph_t> neigh_gids;
         std::vector<std::vector<int>> global_to_stencil_map;
+        std::vector<std::vector<std::array<int, 2>>> requested_gids;  // {owning domain, GID} needed from neighbors
         stencil_gids.resize(tiling.count());
         neigh_gids.resize(tiling.count());
         global_to_stencil_map.resize(tiling.count());
+        requested_gids.resize(tiling.count());
+        auto phaseStart = std::chrono::steady_clock::now();
 
         // get stencil GIDs from each subdomain
-        for (int domIdx = 0; domIdx < tiling.count(); ++domIdx) {
+        for_each_domain([&](const int domIdx) {
             auto [i, j, k] = linear_to_grid_idx(domIdx);
 
             auto & meshFull = m_subdomainVec[domIdx]->getMeshFull();
@@ -247,10 +578,10 @@ private:
                     }
                 }
             }
-        }
+        });
 
         // get stencil GIDs that are required from neighboring domain
-        for (int domIdx = 0; domIdx < tiling.count(); ++domIdx) {
+        for_each_domain([&](const int domIdx) {
             auto [i, j, k] = linear_to_grid_idx(domIdx);
 
             const auto & meshFull = m_subdomainVec[domIdx]->getMeshFull();
@@ -272,7 +603,7 @@ private:
 
                 x_idx = samp_gid % fullMeshDims[0];
                 if (tiling.dim() > 1) {
-                    y_idx = samp_gid / fullMeshDims[0];
+                    y_idx = (samp_gid / fullMeshDims[0]) % fullMeshDims[1];
                 }
                 if (tiling.dim() == 3) {
                     z_idx = samp_gid / (fullMeshDims[0] * fullMeshDims[1]);
@@ -290,6 +621,7 @@ private:
                             int i_neigh = i;
                             int j_neigh = j;
                             int k_neigh = k;
+                            int plane = 0;  // offset of the z-layer, zero in 1D/2D
 
                             // left boundary
                             if ((axisIdx == 0) && (i != 0)) {
@@ -297,7 +629,8 @@ private:
                                 neighIdx = grid_to_linear_idx(i-1, j, k);
                                 auto dims_neigh = m_subdomainVec[neighIdx]->getFullMeshDims();
                                 dist = x_idx;
-                                neigh_gid = (dims_neigh[0] * (y_idx + 1)) - overlap - stencilIdx + dist - 1;
+                                plane = z_idx * dims_neigh[0] * dims_neigh[1];
+                                neigh_gid = plane + (dims_neigh[0] * (y_idx + 1)) - overlap - stencilIdx + dist - 1;
                             }
 
                             // right boundary (1D)
@@ -306,7 +639,7 @@ private:
                                     i_neigh += 1;
                                     neighIdx = grid_to_linear_idx(i+1, j, k);
                                     auto dims_neigh = m_subdomainVec[neighIdx]->getFullMeshDims();
-                                    dist = dims_neigh[0] - x_idx - 1;
+                                    dist = fullMeshDims[0] - x_idx - 1;
                                     neigh_gid =  overlap + stencilIdx - dist;
                                 }
                             }
@@ -318,8 +651,9 @@ private:
                                     j_neigh += 1;
                                     neighIdx = grid_to_linear_idx(i, j+1, k);
                                     auto dims_neigh = m_subdomainVec[neighIdx]->getFullMeshDims();
-                                    dist = dims_neigh[1] - y_idx - 1;
-                                    neigh_gid = (overlap + stencilIdx - dist) * dims_neigh[0] + x_idx;
+                                    dist = fullMeshDims[1] - y_idx - 1;
+                                    plane = z_idx * dims_neigh[0] * dims_neigh[1];
+                                    neigh_gid = plane + (overlap + stencilIdx - dist) * dims_neigh[0] + x_idx;
                                 }
 
                                 // right boundary (2D)
@@ -327,8 +661,9 @@ private:
                                     i_neigh += 1;
                                     neighIdx = grid_to_linear_idx(i+1, j, k);
                                     auto dims_neigh = m_subdomainVec[neighIdx]->getFullMeshDims();
-                                    dist = dims_neigh[0] - x_idx - 1;
-                                    neigh_gid = (dims_neigh[0] * y_idx) + overlap + stencilIdx - dist;
+                                    dist = fullMeshDims[0] - x_idx - 1;
+                                    plane = z_idx * dims_neigh[0] * dims_neigh[1];
+                                    neigh_gid = plane + (dims_neigh[0] * y_idx) + overlap + stencilIdx - dist;
                                 }
 
                                 // back boundary
@@ -337,26 +672,61 @@ private:
                                     neighIdx = grid_to_linear_idx(i, j-1, k);
                                     auto dims_neigh = m_subdomainVec[neighIdx]->getFullMeshDims();
                                     dist = y_idx;
-                                    neigh_gid = (dims_neigh[1] - 1 - overlap - stencilIdx + dist) * dims_neigh[0] + x_idx;
+                                    plane = z_idx * dims_neigh[0] * dims_neigh[1];
+                                    neigh_gid = plane + (dims_neigh[1] - 1 - overlap - stencilIdx + dist) * dims_neigh[0] + x_idx;
                                 }
                             }
 
                             if (tiling.dim() == 3) {
-                                throw std::runtime_error("3D not implemented yet");
+
+                                // bottom boundary
+                                if ((axisIdx == 4) && (k != 0)) {
+                                    k_neigh -= 1;
+                                    neighIdx = grid_to_linear_idx(i, j, k-1);
+                                    auto dims_neigh = m_subdomainVec[neighIdx]->getFullMeshDims();
+                                    dist = z_idx;
+                                    plane = (dims_neigh[2] - 1 - overlap - stencilIdx + dist) * dims_neigh[0] * dims_neigh[1];
+                                    neigh_gid = plane + y_idx * dims_neigh[0] + x_idx;
+                                }
+
+                                // top boundary
+                                if ((axisIdx == 5) && (k != tiling.countZ() - 1)) {
+                                    k_neigh += 1;
+                                    neighIdx = grid_to_linear_idx(i, j, k+1);
+                                    auto dims_neigh = m_subdomainVec[neighIdx]->getFullMeshDims();
+                                    dist = fullMeshDims[2] - z_idx - 1;
+                                    plane = (overlap + stencilIdx - dist) * dims_neigh[0] * dims_neigh[1];
+                                    neigh_gid = plane + y_idx * dims_neigh[0] + x_idx;
+                                }
                             }
 
                             if (neigh_gid != -1) {
                                 neigh_gids[domIdx](sampIdx, connect_idx) = neigh_gid;
-                                stencil_gids[neighIdx].emplace_back(neigh_gid);
+                                requested_gids[domIdx].push_back({neighIdx, neigh_gid});
                             }
                         }
                     }
                 }
             }
-        }
+        });
+
+        // gather GIDs requested by neighbors, each domain only appends to its own list
+        const auto & exchDomIdVec = tiling.exchDomIdVec();
+        for_each_domain([&](const int domIdx) {
+            for (const auto neighDomIdx : exchDomIdVec[domIdx]) {
+                if (neighDomIdx == -1) {
+                    continue;
+                }
+                for (const auto & request : requested_gids[neighDomIdx]) {
+                    if (request[0] == domIdx) {
+                        stencil_gids[domIdx].emplace_back(request[1]);
+                    }
+                }
+            }
+        });
 
         // sort and store stencil GIDs
-        for (int domIdx = 0; domIdx < tiling.count(); ++domIdx) {
+        for_each_domain([&](const int domIdx) {
             auto [i, j, k] = linear_to_grid_idx(domIdx);
             std::sort( stencil_gids[domIdx].begin(), stencil_gids[domIdx].end() );
             stencil_gids[domIdx].erase(
@@ -369,121 +739,38 @@ private:
 
             m_subdomainVec[domIdx]->setStencilGids(stencil_gids[domIdx]);
 
-        }
+        });
+        record_setup_time("stencil GIDs", phaseStart);
 
-        // generate global-to-stencil map
-        for (int domIdx = 0; domIdx < tiling.count(); ++domIdx) {
-            auto [i, j, k] = linear_to_grid_idx(domIdx);
+        // generate global-to-stencil map, direct-indexed by the sorted stencil GIDs
+        for_each_domain([&](const int domIdx) {
             const auto & meshFull = m_subdomainVec[domIdx]->getMeshFull();
 
-            global_to_stencil_map[domIdx].resize(meshFull.sampleMeshSize(), -1);
-            int stencilIdx = 0;
-            for (int cellIdx = 0; cellIdx < meshFull.sampleMeshSize(); ++cellIdx) {
-                if (std::find(stencil_gids[domIdx].begin(), stencil_gids[domIdx].end(), cellIdx) != stencil_gids[domIdx].end()) {
-                    global_to_stencil_map[domIdx][cellIdx] = stencilIdx;
-                    stencilIdx++;
-                }
+            global_to_stencil_map[domIdx].assign(meshFull.sampleMeshSize(), -1);
+            for (int stencilIdx = 0; stencilIdx < stencil_gids[domIdx].size(); ++stencilIdx) {
+                global_to_stencil_map[domIdx][stencil_gids[domIdx][stencilIdx]] = stencilIdx;
             }
-        }
+        });
+        record_setup_time("global-to-stencil maps", phaseStart);
 
-        // write coordinates and connectivity
-        for (int domIdx = 0; domIdx < tiling.count(); ++domIdx) {
-            // make subdirectory
+        for_each_domain([&](const int domIdx) {
             std::string subdom_dir = m_tempdir + "/domain_" + std::to_string(domIdx);
-            std::filesystem::create_directory(subdom_dir);
-
             auto [i, j, k] = linear_to_grid_idx(domIdx);
             const auto & meshFull = m_subdomainVec[domIdx]->getMeshFull();
             const auto * sampGids = m_subdomainVec[domIdx]->getSampleGids();
             const auto & graphFull = meshFull.graph();
 
-            // sampled GIDs (rewritten mostly for post-processing's sake)
-            std::ofstream sample_file(subdom_dir + "/sample_mesh_gids.dat");
-            for (int sampIdx = 0; sampIdx < sampGids->rows(); ++sampIdx) {
-                int samp_gid = (*sampGids)(sampIdx);
-                sample_file << std::to_string(samp_gid) + "\n";
-            }
-            sample_file.close();
-
-            // stencil GIDs
-            std::ofstream stencil_file(subdom_dir + "/stencil_mesh_gids.dat");
-            for (int stencilIdx = 0; stencilIdx < stencil_gids[domIdx].size(); ++stencilIdx) {
-                int stencil_gid = stencil_gids[domIdx][stencilIdx];
-                stencil_file << std::to_string(stencil_gid) + "\n";
-            }
-            stencil_file.close();
-
-            // connectivity
-            std::ofstream connect_hyper_file(subdom_dir + "/connectivity.dat");
-            for (int sampIdx = 0; sampIdx < sampGids->rows(); ++sampIdx) {
-                int samp_gid = (*sampGids)(sampIdx);
-                connect_hyper_file << std::to_string(global_to_stencil_map[domIdx][samp_gid]);
-                for (int stencilIdx = 1; stencilIdx < graphFull.cols(); ++stencilIdx) {
-                    int stencil_gid = graphFull(samp_gid, stencilIdx);
-                    if (stencil_gid == -1) {
-                        connect_hyper_file << " " + std::to_string(-1);
-                    }
-                    else {
-                        connect_hyper_file << " " + std::to_string(global_to_stencil_map[domIdx][stencil_gid]);
-                    }
-                }
-                connect_hyper_file << "\n";
-            }
-            connect_hyper_file.close();
-
-            // coordinates
-            std::ofstream coords_file(subdom_dir + "/coordinates.dat");
-            auto & xcoords = meshFull.viewX();
-            auto & ycoords = meshFull.viewY();
-            auto & zcoords = meshFull.viewZ();
-            for (int stencilIdx = 0; stencilIdx < stencil_gids[domIdx].size(); ++stencilIdx) {
-                int stencil_gid = stencil_gids[domIdx][stencilIdx];
-                coords_file << std::to_string(stencilIdx);
-
-                coords_file << " " << std::fixed << std::setprecision(14) << xcoords(stencil_gid);
-                if (tiling.dim() > 1) {
-                    coords_file << " " << std::fixed << std::setprecision(14) << ycoords(stencil_gid);
-                }
-                if (tiling.dim() == 3) {
-                    coords_file << " " << std::fixed << std::setprecision(14) << zcoords(stencil_gid);
-                }
-                coords_file << "\n";
-            }
-            coords_file.close();
+#ifdef SCHWARZ_SAVE_TEMPDIR
+            // sample and stencil GIDs are only needed for post-processing
+            write_stencil_gids(domIdx, subdom_dir, stencil_gids[domIdx]);
+#endif
 
-            // info
-            std::ofstream info_file(subdom_dir + "/info.dat");
-            info_file << "dim " + std::to_string(tiling.dim()) + "\n";
-            auto xmin = xcoords.minCoeff() - meshFull.dx() / 2.0;
-            auto xmax = xcoords.maxCoeff() + meshFull.dx() / 2.0;
-            info_file << "xMin " << std::fixed << std::setprecision(14) << xmin << "\n";
-            info_file << "xMax " << std::fixed << std::setprecision(14) << xmax << "\n";
-            if (tiling.dim() > 1) {
-                auto ymin = ycoords.minCoeff() - meshFull.dy() / 2.0;
-                auto ymax = ycoords.maxCoeff() + meshFull.dy() / 2.0;
-                info_file << "yMin " << std::fixed << std::setprecision(14) << ymin << "\n";
-                info_file << "yMax " << std::fixed << std::setprecision(14) << ymax << "\n";
-            }
-            if (tiling.dim() == 3) {
-                auto zmin = zcoords.minCoeff() - meshFull.dz() / 2.0;
-                auto zmax = zcoords.maxCoeff() + meshFull.dz() / 2.0;
-                info_file << "zMin " << std::fixed << std::setprecision(14) << zmin << "\n";
-                info_file << "zMax " << std::fixed << std::setprecision(14) << zmax << "\n";
-            }
-            info_file << "dx " << std::fixed << std::setprecision(14) << meshFull.dx() << "\n";
-            if (tiling.dim() > 1) {
-                info_file << "dy " << std::fixed << std::setprecision(14) << meshFull.dy() << "\n";
-            }
-            if (tiling.dim() == 3) {
-                info_file << "dz " << std::fixed << std::setprecision(14) << meshFull.dz() << "\n";
+            // the stencil mesh can only be loaded from a mesh directory, so it's
+            //      only written (to node-local scratch) for hyper-reduced subdomains
+            if (m_subdomainVec[domIdx]->isHyperReduced() && needs_stencil_mesh(domIdx)) {
+                write_stencil_mesh(domIdx, subdom_dir, stencil_gids[domIdx], global_to_stencil_map[domIdx]);
+                m_subdomainVec[domIdx]->genHyperMesh(subdom_dir);
             }
-            info_file << "sampleMeshSize " << sampGids->rows() << "\n";
-            info_file << "stencilMeshSize " << stencil_gids[domIdx].size() << "\n";
-            info_file << "stencilSize " << meshFull.stencilSize() << "\n";
-            info_file.close();
-
-            // generate sample mesh (noop for FOM/PROM)
-            m_subdomainVec[domIdx]->genHyperMesh(subdom_dir);
 
             // generate neighbor connectivity
             graph_t neighborGraph;
@@ -545,8 +832,111 @@ private:
 
             m_subdomainVec[domIdx]->setNeighborGraph(neighborGraph);
 
+        });
+        record_setup_time("stencil meshes and neighbor graphs", phaseStart);
+
+    }
+
+    void write_stencil_gids(const int domIdx, const std::string & subdom_dir, const std::vector<int> & stencil_gids)
+    {
+        std::filesystem::create_directories(subdom_dir);
+        const auto * sampGids = m_subdomainVec[domIdx]->getSampleGids();
+
+        std::ofstream sample_file(subdom_dir + "/sample_mesh_gids.dat");
+        for (int sampIdx = 0; sampIdx < sampGids->rows(); ++sampIdx) {
+            sample_file << (*sampGids)(sampIdx) << "\n";
+        }
+        sample_file.close();
+
+        std::ofstream stencil_file(subdom_dir + "/stencil_mesh_gids.dat");
+        for (const auto stencil_gid : stencil_gids) {
+            stencil_file << stencil_gid << "\n";
         }
+        stencil_file.close();
+    }
 
+    // writes the stencil mesh in the pressio-demoapps mesh format
+    // each file is formatted in memory and written in a single call
+    void write_stencil_mesh(const int domIdx, const std::string & subdom_dir,
+                            const std::vector<int> & stencil_gids,
+                            const std::vector<int> & global_to_stencil_map)
+    {
+        const auto & tiling = *m_tiling;
+        const auto & meshFull = m_subdomainVec[domIdx]->getMeshFull();
+        const auto * sampGids = m_subdomainVec[domIdx]->getSampleGids();
+        const auto & graphFull = meshFull.graph();
+
+        std::filesystem::create_directories(subdom_dir);
+        auto write_file = [&](const std::string & filename, const std::ostringstream & contents) {
+            std::ofstream outfile(subdom_dir + "/" + filename, std::ios::binary);
+            const auto & str = contents.str();
+            outfile.write(str.data(), str.size());
+        };
+
+        // connectivity
+        std::ostringstream connect_hyper;
+        for (int sampIdx = 0; sampIdx < sampGids->rows(); ++sampIdx) {
+            int samp_gid = (*sampGids)(sampIdx);
+            connect_hyper << global_to_stencil_map[samp_gid];
+            for (int stencilIdx = 1; stencilIdx < graphFull.cols(); ++stencilIdx) {
+                int stencil_gid = graphFull(samp_gid, stencilIdx);
+                connect_hyper << " " << ((stencil_gid == -1) ? -1 : global_to_stencil_map[stencil_gid]);
+            }
+            connect_hyper << "\n";
+        }
+        write_file("connectivity.dat", connect_hyper);
+
+        // coordinates
+        std::ostringstream coords;
+        coords << std::fixed << std::setprecision(14);
+        auto & xcoords = meshFull.viewX();
+        auto & ycoords = meshFull.viewY();
+        auto & zcoords = meshFull.viewZ();
+        for (int stencilIdx = 0; stencilIdx < stencil_gids.size(); ++stencilIdx) {
+            int stencil_gid = stencil_gids[stencilIdx];
+            coords << stencilIdx;
+            coords << " " << xcoords(stencil_gid);
+            if (tiling.dim() > 1) {
+                coords << " " << ycoords(stencil_gid);
+            }
+            if (tiling.dim() == 3) {
+                coords << " " << zcoords(stencil_gid);
+            }
+            coords << "\n";
+        }
+        write_file("coordinates.dat", coords);
+
+        // info
+        std::ostringstream info;
+        info << "dim " << tiling.dim() << "\n";
+        info << std::fixed << std::setprecision(14);
+        auto xmin = xcoords.minCoeff() - meshFull.dx() / 2.0;
+        auto xmax = xcoords.maxCoeff() + meshFull.dx() / 2.0;
+        info << "xMin " << xmin << "\n";
+        info << "xMax " << xmax << "\n";
+        if (tiling.dim() > 1) {
+            auto ymin = ycoords.minCoeff() - meshFull.dy() / 2.0;
+            auto ymax = ycoords.maxCoeff() + meshFull.dy() / 2.0;
+            info << "yMin " << ymin << "\n";
+            info << "yMax " << ymax << "\n";
+        }
+        if (tiling.dim() == 3) {
+            auto zmin = zcoords.minCoeff() - meshFull.dz() / 2.0;
+            auto zmax = zcoords.maxCoeff() + meshFull.dz() / 2.0;
+            info << "zMin " << zmin << "\n";
+            info << "zMax " << zmax << "\n";
+        }
+        info << "dx " << meshFull.dx() << "\n";
+        if (tiling.dim() > 1) {
+            info << "dy " << meshFull.dy() << "\n";
+        }
+        if (tiling.dim() == 3) {
+            info << "dz " << meshFull.dz() << "\n";
+        }
+        info << "sampleMeshSize " << sampGids->rows() << "\n";
+        info << "stencilMeshSize " << stencil_gids.size() << "\n";
+        info << "stencilSize " << meshFull.stencilSize() << "\n";
+        write_file("info.dat", info);
     }
 
     // determines whether LOCAL neighbor orientation indices correspond to the same neighbors
@@ -585,13 +975,11 @@ private:
 
     void calc_exch_graph()
     {
-        // TODO: extend to 3D
-
         const auto & tiling = *m_tiling;
         m_broadcastGraphVec.resize(tiling.count());
 
         const auto exchDomIds = tiling.exchDomIdVec();
-        for (int domIdx = 0; domIdx < tiling.count(); ++domIdx) {
+        for_each_domain([&](const int domIdx) {
 
             // entry for every possible neighbor
             m_broadcastGraphVec[domIdx].resize(2 * tiling.dim());
@@ -603,6 +991,9 @@ private:
                 if (neighDomIdx == -1) {
                     continue;  // not a Schwarz BC
                 }
+                if (!m_ownedVec[domIdx] && !m_ownedVec[neighDomIdx]) {
+                    continue;  // exchanged between other processes
+                }
 
                 const auto & neighMeshObj = m_subdomainVec[neighDomIdx]->getMeshStencil();
                 const auto & neighNeighborGraph = m_subdomainVec[neighDomIdx]->getNeighborGraph();
@@ -627,13 +1018,53 @@ private:
                 }
 
             } // neighbor loop
-        } // domain loop
+        }); // domain loop
+
+        calc_exch_plan();
+    }
+
+    void calc_exch_plan()
+    {
+        m_exchPlanVec.resize(m_broadcastGraphVec.size());
+        for_each_domain([&](const int domIdx) {
+            auto & plan = m_exchPlanVec[domIdx];
+            plan.m_offsets.assign(1, 0);
+            plan.m_source.clear();
+            plan.m_target.clear();
+            for (const auto & broadcastGraph : m_broadcastGraphVec[domIdx]) {
+                for (const auto & bcPair : broadcastGraph) {
+                    plan.m_source.push_back(bcPair[0] * m_dofPerCell);
+                    plan.m_target.push_back(bcPair[1] * m_dofPerCell);
+                }
+                plan.m_offsets.push_back(plan.m_source.size());
+            }
+        });
+    }
+
+    template<class scalar_t>
+    void copy_blocks(const scalar_t * src, const int * srcIdx,
+                     scalar_t * dst, const int * dstIdx, const int count) const
+    {
+        switch (m_dofPerCell)
+        {
+            case 3:
+                copy_cell_blocks<3>(src, srcIdx, dst, dstIdx, count, m_dofPerCell);
+                break;
+            case 4:
+                copy_cell_blocks<4>(src, srcIdx, dst, dstIdx, count, m_dofPerCell);
+                break;
+            default:
+                copy_cell_blocks<0>(src, srcIdx, dst, dstIdx, count, m_dofPerCell);
+        }
     }
 
-    void broadcast_bcState(const int domIdx)
+    // toBack writes into the neighbors' back buffers, which become active on swapStateBCs()
+    void broadcast_bcState(const int domIdx, const bool toBack = false)
     {
+        PhaseTimer timer(m_instrumentation.get(), domIdx, Phase::Broadcast);
         const auto & tiling = *m_tiling;
         const auto & exchDomIdVec = tiling.exchDomIdVec();
+        const auto & plan = m_exchPlanVec[domIdx];
         const auto * state = m_subdomainVec[domIdx]->getStateStencil();
 
         for (auto neighIdx = 0; neighIdx < exchDomIdVec[domIdx].size(); ++neighIdx) {
@@ -643,15 +1074,17 @@ private:
                 continue;  // not a Schwarz BC
             }
 
-            auto * neighStateBCs = m_subdomainVec[neighDomIdx]->getStateBCs();
-
-            for (auto bcIdx = 0; bcIdx < m_broadcastGraphVec[domIdx][neighIdx].size(); ++bcIdx) {
-                auto sourceGID = m_broadcastGraphVec[domIdx][neighIdx][bcIdx][0];
-                auto targetBCID = m_broadcastGraphVec[domIdx][neighIdx][bcIdx][1];
-                for (auto dofIdx = 0; dofIdx < m_dofPerCell; ++dofIdx) {
-                    (*neighStateBCs)(targetBCID * m_dofPerCell + dofIdx) = (*state)(sourceGID * m_dofPerCell + dofIdx);
-                }
+            if (!m_ownedVec[neighDomIdx]) {
+                continue;  // sent by SchwarzDecompMPI
             }
+
+            auto * neighStateBCs = toBack ? m_subdomainVec[neighDomIdx]->getStateBCsBack()
+                                          : m_subdomainVec[neighDomIdx]->getStateBCs();
+
+            const int start = plan.m_offsets[neighIdx];
+            copy_blocks(state->data(), plan.m_source.data() + start,
+                        neighStateBCs->data(), plan.m_target.data() + start,
+                        plan.m_offsets[neighIdx + 1] - start);
         }
     }
 
@@ -661,7 +1094,7 @@ private:
         const auto & exchDomIdVec = tiling.exchDomIdVec();
 
         m_ghostGraphVec.resize(tiling.count());
-        for (int domIdx = 0; domIdx < tiling.count(); ++domIdx) {
+        for_each_owned_domain([&](const int domIdx) {
 
             const auto & meshObj = m_subdomainVec[domIdx]->getMeshStencil();
             const auto & neighborGraph = m_subdomainVec[domIdx]->getNeighborGraph();
@@ -720,10 +1153,99 @@ private:
                     m_subdomainVec[domIdx]->setBCPointer(pda::impl::GhostRelativeLocation::Back, &m_ghostGraphVec[domIdx][3]);
                 }
 
-                // TODO: expand to 3D
+                // bottom neighbor
+                if (neighIdx == 4) {
+                    m_subdomainVec[domIdx]->setBCPointer(pda::impl::GhostRelativeLocation::Bottom, m_subdomainVec[domIdx]->getStateBCs());
+                    m_subdomainVec[domIdx]->setBCPointer(pda::impl::GhostRelativeLocation::Bottom, &m_ghostGraphVec[domIdx][4]);
+                }
+
+                // top neighbor
+                if (neighIdx == 5) {
+                    m_subdomainVec[domIdx]->setBCPointer(pda::impl::GhostRelativeLocation::Top, m_subdomainVec[domIdx]->getStateBCs());
+                    m_subdomainVec[domIdx]->setBCPointer(pda::impl::GhostRelativeLocation::Top, &m_ghostGraphVec[domIdx][5]);
+                }
 
             } // neighbor loop
-        } // domain loop
+        }); // domain loop
+    }
+
+    void calc_interface_buffers()
+    {
+        const auto & tiling = *m_tiling;
+        const auto & exchDomIdVec = tiling.exchDomIdVec();
+
+        m_interfaceBufferVec.resize(tiling.count());
+        for_each_owned_domain([&](const int domIdx) {
+            m_interfaceBufferVec[domIdx].resize(exchDomIdVec[domIdx].size());
+            for (int neighIdx = 0; neighIdx < exchDomIdVec[domIdx].size(); ++neighIdx) {
+                if (exchDomIdVec[domIdx][neighIdx] == -1) {
+                    continue;  // not a Schwarz BC
+                }
+                m_interfaceBufferVec[domIdx][neighIdx] = std::make_unique<InterfaceBuffer>();
+                m_interfaceBufferVec[domIdx][neighIdx]->m_data.resize(
+                    m_broadcastGraphVec[domIdx][neighIdx].size() * m_dofPerCell);
+            }
+        });
+    }
+
+    // pack boundary data of domIdx into the buffers read by its neighbors
+    void publish_bcState(const int domIdx)
+    {
+        PhaseTimer timer(m_instrumentation.get(), domIdx, Phase::Broadcast);
+        const auto & exchDomIdVec = m_tiling->exchDomIdVec();
+        const auto & plan = m_exchPlanVec[domIdx];
+        const auto * state = m_subdomainVec[domIdx]->getStateStencil();
+
+        for (int neighIdx = 0; neighIdx < exchDomIdVec[domIdx].size(); ++neighIdx) {
+            if (exchDomIdVec[domIdx][neighIdx] == -1) {
+                continue;  // not a Schwarz BC
+            }
+
+            auto & buffer = *m_interfaceBufferVec[domIdx][neighIdx];
+            const int start = plan.m_offsets[neighIdx];
+            std::lock_guard<std::mutex> lock(buffer.m_mutex);
+            copy_blocks(state->data(), plan.m_source.data() + start,
+                        buffer.m_data.data(), (const int *) nullptr,
+                        plan.m_offsets[neighIdx + 1] - start);
+            buffer.m_version++;
+        }
+    }
+
+    // copy any boundary data published by neighbors since the last pull into domIdx's m_stateBCs
+    // returns true if new data was received
+    bool pull_bcState(const int domIdx)
+    {
+        const auto & exchDomIdVec = m_tiling->exchDomIdVec();
+        auto * stateBCs = m_subdomainVec[domIdx]->getStateBCs();
+
+        bool received = false;
+        for (const auto neighDomIdx : exchDomIdVec[domIdx]) {
+            if (neighDomIdx == -1) {
+                continue;  // not a Schwarz BC
+            }
+
+            // find the interface of the neighbor which faces this domain
+            for (int neighIdx = 0; neighIdx < exchDomIdVec[neighDomIdx].size(); ++neighIdx) {
+                if (exchDomIdVec[neighDomIdx][neighIdx] != domIdx) {
+                    continue;
+                }
+
+                auto & buffer = *m_interfaceBufferVec[neighDomIdx][neighIdx];
+                if (buffer.m_version.load() == buffer.m_consumed.load()) {
+                    continue;  // nothing new
+                }
+
+                const auto & plan = m_exchPlanVec[neighDomIdx];
+                const int start = plan.m_offsets[neighIdx];
+                std::lock_guard<std::mutex> lock(buffer.m_mutex);
+                copy_blocks(buffer.m_data.data(), (const int *) nullptr,
+                            stateBCs->data(), plan.m_target.data() + start,
+                            plan.m_offsets[neighIdx + 1] - start);
+                buffer.m_consumed = buffer.m_version.load();
+                received = true;
+            }
+        }
+        return received;
     }
 
     template <class state_t>
@@ -740,22 +1262,74 @@ private:
 
         // absolute error
         const double abs_err = (state1 - state2).squaredNorm();
+        const double rel_err = calcRelativeError(abs_err, state1.squaredNorm());
+        return {abs_err, rel_err};
+    }
 
+    // convergence measured only on cells broadcast to neighbors, per variable
+    // the worst variable is reported, so that no field is masked by a larger one
+    template <class state_t>
+    std::array<double, 2> calcInterfaceConvergence(int domIdx, const state_t & state1, const state_t & state2)
+    {
+        std::vector<double> absErrVec(m_dofPerCell, 0.0);
+        std::vector<double> baseNormVec(m_dofPerCell, 0.0);
+        for (const auto sourceIdx : m_exchPlanVec[domIdx].m_source) {
+            for (int dofIdx = 0; dofIdx < m_dofPerCell; ++dofIdx) {
+                const auto idx = sourceIdx + dofIdx;
+                const double diff = state1(idx) - state2(idx);
+                absErrVec[dofIdx] += diff * diff;
+                baseNormVec[dofIdx] += state1(idx) * state1(idx);
+            }
+        }
+
+        double abs_err = 0.0;
+        double rel_err = 0.0;
+        for (int dofIdx = 0; dofIdx < m_dofPerCell; ++dofIdx) {
+            abs_err = std::max(abs_err, absErrVec[dofIdx]);
+            rel_err = std::max(rel_err, calcRelativeError(absErrVec[dofIdx], baseNormVec[dofIdx]));
+        }
+        return {abs_err, rel_err};
+    }
+
+    static double calcRelativeError(const double abs_err, const double basenorm)
+    {
         // handle edge cases for relative error
-        double rel_err;
-        double basenorm = state1.squaredNorm();
         if (basenorm > 0) {
-            rel_err = abs_err / basenorm;
+            return abs_err / basenorm;
         }
         else {
             if (abs_err > 0) {
-                rel_err = 1.0;
+                return 1.0;
             }
             else {
-                rel_err = 0.0;
+                return 0.0;
             }
         }
-        return {abs_err, rel_err};
+    }
+
+    void reduce_errors(Errors & total, const Errors & errors)
+    {
+        if (m_errReduction == ErrorReduction::Max) {
+            total.m_absolute = std::max(total.m_absolute, errors.m_absolute);
+            total.m_relative = std::max(total.m_relative, errors.m_relative);
+        }
+        else {
+            total.m_absolute += errors.m_absolute;
+            total.m_relative += errors.m_relative;
+        }
+    }
+
+    void finalize_errors(Errors & total, const int ndomains)
+    {
+        if (m_errReduction == ErrorReduction::Average) {
+            total.m_absolute /= ndomains;
+            total.m_relative /= ndomains;
+        }
+    }
+
+    const char * error_label() const
+    {
+        return (m_errReduction == ErrorReduction::Max) ? "Max" : "Average";
     }
 
 public:
@@ -767,11 +1341,17 @@ public:
         const auto & tiling = *m_tiling;
         const auto ndomains = tiling.count();
 
+        // the last iteration of the previous step was broadcast into the back buffers only
+        if (has_predictor()) {
+            for (int domIdx = 0; domIdx < ndomains; ++domIdx) { broadcast_bcState(domIdx); }
+        }
         for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
             m_subdomainVec[domIdx]->storeStateHistory(0);
+            predict_bcState(domIdx);
         }
 
         Eigen::Matrix<Errors, -1, -1, Eigen::RowMajor> errs(ndomains, 16);
+        std::vector<char> active(ndomains, 1);
         int convergeStep = 0;
         while (convergeStep < convergeStepMax) {
             m_ae = {};
@@ -782,34 +1362,30 @@ public:
                 }
             }
 
-            auto task1 = [&](int domIdx) {
-                domainControlLoop(domIdx, currentTime, outerStep, errs(domIdx, 0));
-            };
-            pool.detach_loop<int>(0, ndomains, task1);
-            pool.wait();
+            // neighbors' BC functors only read the front buffers, so each subdomain broadcasts as soon as it is done
+            run_schwarz_iteration(pool, m_allDomIds, currentTime, outerStep, convergeStep, errs, active,
+                [&](int domIdx) { if (needs_back_broadcast(domIdx, active[domIdx])) { broadcast_bcState(domIdx, true); } });
 
+            Errors totalErrs = {};
             for(int i = 0 ; i < ndomains ; ++i){
-                m_ae += errs(i, 0).m_absolute;
-                m_re += errs(i, 0).m_relative;
+                reduce_errors(totalErrs, errs(i, 0));
             }
-            m_re /= double(ndomains);
-            m_ae /= double(ndomains);
+            finalize_errors(totalErrs, active_count(active));
+            m_ae = totalErrs.m_absolute;
+            m_re = totalErrs.m_relative;
             std::cout << "Schwarz iteration " << convergeStep + 1 << "\n";
-            std::cout << "Average abs err: " << m_ae << "\n";
-            std::cout << "Average rel err: " << m_re << '\n';
+            print_active_count(active);
+            std::cout << error_label() << " abs err: " << m_ae << "\n";
+            std::cout << error_label() << " rel err: " << m_re << '\n';
 
             if ((m_re < rel_err_tol) || (m_ae < abs_err_tol)) {
                 break;
             }
             convergeStep++;
 
-            auto task = [&](const int domIdx){ broadcast_bcState(domIdx); };
-            pool.detach_loop<int>(0, ndomains, task);
-            pool.wait();
-
-            auto taskreset = [&](const int domIdx){ m_subdomainVec[domIdx]->resetStateFromHistory(); };
-            pool.detach_loop<int>(0, ndomains, taskreset);
-            pool.wait();
+            for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+                m_subdomainVec[domIdx]->swapStateBCs();
+            }
         }
 
         // breaks before counter increments
@@ -823,11 +1399,20 @@ public:
         const auto & tiling = *m_tiling;
         const auto ndomains = tiling.count();
 
+        // see thread pool overload
+        if (has_predictor()) {
+#if defined SCHWARZ_ENABLE_OMP
+#pragma omp for schedule(static)
+#endif
+            for (int domIdx = 0; domIdx < ndomains; ++domIdx) { broadcast_bcState(domIdx); }
+        }
+
 #if defined SCHWARZ_ENABLE_OMP
 #pragma omp for schedule(static)
 #endif
         for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
             m_subdomainVec[domIdx]->storeStateHistory(0);
+            predict_bcState(domIdx);
         }
 
 #if defined SCHWARZ_ENABLE_OMP
@@ -846,33 +1431,53 @@ public:
             {
                 m_ae = {};
                 m_re = {};
+                m_activeCount = 0;
             }
 
             myerrs = {};
+            int myActiveCount = 0;
 #if defined SCHWARZ_ENABLE_OMP
 #pragma omp for schedule(static, 1)
 #endif
             for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
-                domainControlLoop(domIdx, currentTime, outerStep, myerrs);
+                const bool active = timed_iterate(domIdx, currentTime, outerStep, convergeStep, myerrs);
+                myActiveCount += active;
+                // double-buffered, see thread pool overload
+                if (needs_back_broadcast(domIdx, active)) { broadcast_bcState(domIdx, true); }
             }
 
+            if (m_errReduction == ErrorReduction::Max) {
 #if defined SCHWARZ_ENABLE_OMP
-#pragma omp for reduction (+: m_ae, m_re)
+#pragma omp for reduction (max: m_ae, m_re)
 #endif
-            for(int i = 0 ; i < threadCount; ++i){
-                m_ae += myerrs.m_absolute;
-                m_re += myerrs.m_relative;
+                for(int i = 0 ; i < threadCount; ++i){
+                    m_ae = std::max(m_ae, myerrs.m_absolute);
+                    m_re = std::max(m_re, myerrs.m_relative);
+                }
+            }
+            else {
+#if defined SCHWARZ_ENABLE_OMP
+#pragma omp for reduction (+: m_ae, m_re, m_activeCount)
+#endif
+                for(int i = 0 ; i < threadCount; ++i){
+                    m_ae += myerrs.m_absolute;
+                    m_re += myerrs.m_relative;
+                    m_activeCount += myActiveCount;
+                }
             }
 
 #if defined SCHWARZ_ENABLE_OMP
 #pragma omp master
 #endif
             {
-                m_re /= double(ndomains);
-                m_ae /= double(ndomains);
+                if (m_errReduction == ErrorReduction::Average) {
+                    // frozen subdomains contribute no error, so they are left out of the average
+                    m_re /= double(std::max(m_activeCount, 1));
+                    m_ae /= double(std::max(m_activeCount, 1));
+                }
                 std::cout << "Schwarz iteration " << convergeStep + 1 << '\n';
-                std::cout << "Average abs err: " << m_ae << "\n";
-                std::cout << "Average rel err: " << m_re << "\n";
+                std::cout << error_label() << " abs err: " << m_ae << "\n";
+                std::cout << error_label() << " rel err: " << m_re << "\n";
             }
 
 #if defined SCHWARZ_ENABLE_OMP
@@ -888,14 +1493,7 @@ public:
 #pragma omp for schedule(static, 1)
 #endif
             for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
-                broadcast_bcState(domIdx);
-            }
-
-#if defined SCHWARZ_ENABLE_OMP
-#pragma omp for schedule(static, 1)
-#endif
-            for (int domIdx = 0; domIdx < ndomains; ++domIdx){
-                m_subdomainVec[domIdx]->resetStateFromHistory();
+                m_subdomainVec[domIdx]->swapStateBCs();
             }
         } // convergence loop
 
@@ -904,6 +1502,191 @@ public:
     }
 
 
+    int multiplicative_step(int outerStep, double currentTime,
+                            const double rel_err_tol, const double abs_err_tol,
+                            const int convergeStepMax, BS::thread_pool & pool)
+    {
+        const auto & tiling = *m_tiling;
+        const auto ndomains = tiling.count();
+        const auto & colorDomIds = tiling.colorDomIdVec();
+
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            m_subdomainVec[domIdx]->storeStateHistory(0);
+            predict_bcState(domIdx);
+        }
+
+        Eigen::Matrix<Errors, -1, -1, Eigen::RowMajor> errs(ndomains, 16);
+        std::vector<char> active(ndomains, 1);
+        int convergeStep = 0;
+        while (convergeStep < convergeStepMax) {
+            m_ae = {};
+            m_re = {};
+            for (int i = 0; i < errs.rows(); ++i) {
+                for (int j = 0; j < errs.cols(); ++j) {
+                    errs(i, j) = {};
+                }
+            }
+
+            // subdomains of one color share no interfaces, so they are solved concurrently
+            // each broadcasts as soon as it finishes, as its neighbors all belong to other colors
+            for (const auto & domIds : colorDomIds) {
+                run_schwarz_iteration(pool, domIds, currentTime, outerStep, convergeStep, errs, active,
+                    [&](int domIdx) { if (active[domIdx]) { broadcast_bcState(domIdx); } });
+            }
+
+            Errors totalErrs = {};
+            for(int i = 0 ; i < ndomains ; ++i){
+                reduce_errors(totalErrs, errs(i, 0));
+            }
+            finalize_errors(totalErrs, active_count(active));
+            m_ae = totalErrs.m_absolute;
+            m_re = totalErrs.m_relative;
+            std::cout << "Schwarz iteration " << convergeStep + 1 << "\n";
+            print_active_count(active);
+            std::cout << error_label() << " abs err: " << m_ae << "\n";
+            std::cout << error_label() << " rel err: " << m_re << '\n';
+
+            if ((m_re < rel_err_tol) || (m_ae < abs_err_tol)) {
+                break;
+            }
+            convergeStep++;
+        }
+
+        // breaks before counter increments
+        return convergeStep + 1;
+    }
+
+    int asynchronous_step(int outerStep, double currentTime,
+                          const double rel_err_tol, const double abs_err_tol,
+                          const int convergeStepMax, BS::thread_pool & pool)
+    {
+        // Each subdomain iterates on the newest neighbor data it has received,
+        // without waiting on the others. A subdomain re-solves while it is not
+        // converged or when a neighbor published new data, up to convergeStepMax
+        // solves. The step ends once all subdomains are idle and no data is in flight.
+
+        // subdomains only re-solve on new data already, and there is no common iteration to accelerate
+        if (m_freezeTol > 0.0) {
+            throw std::runtime_error("Asynchronous Schwarz does not support freezing subdomains");
+        }
+        if (has_accelerator()) {
+            throw std::runtime_error("Asynchronous Schwarz does not support interface accelerators");
+        }
+
+        const auto & tiling = *m_tiling;
+        const auto ndomains = tiling.count();
+
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            m_subdomainVec[domIdx]->storeStateHistory(0);
+        }
+
+        // make the current boundary states the baseline for this step
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            pull_bcState(domIdx);
+            predict_bcState(domIdx);
+        }
+
+        Eigen::Matrix<Errors, -1, -1, Eigen::RowMajor> errs(ndomains, 16);
+        std::vector<char> converged(ndomains, 0);
+        std::vector<int> localIters(ndomains, 0);
+        // solve requests per subdomain, a task is queued only on the 0 -> 1 transition, so that
+        //      each subdomain has at most one task queued or running, which serves all requests
+        //      made before it finishes. The step ends once the pool runs out of tasks.
+        std::vector<std::atomic<int>> requests(ndomains);
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            requests[domIdx] = 0;
+        }
+        std::atomic<bool> failed{false};
+        std::exception_ptr failure;
+        std::mutex failureMutex;
+
+        std::function<void(int)> task;
+        auto request = [&](const int domIdx) {
+            if (requests[domIdx].fetch_add(1) == 0) {
+                pool.detach_task([&task, domIdx]{ task(domIdx); });
+            }
+        };
+
+        task = [&](const int domIdx) {
+            const int served = requests[domIdx].load();
+            try {
+                const bool received = pull_bcState(domIdx);
+                const int iters = localIters[domIdx];
+                if (!failed.load() && (iters < convergeStepMax) && (!converged[domIdx] || received)) {
+                    if (iters > 0) {
+                        PhaseTimer timer(m_instrumentation.get(), domIdx, Phase::ResetHistory);
+                        m_subdomainVec[domIdx]->resetStateFromHistory();
+                    }
+                    errs(domIdx, 0) = {};
+                    domainControlLoop(domIdx, currentTime, outerStep, errs(domIdx, 0));
+                    converged[domIdx] = ((errs(domIdx, 0).m_relative < rel_err_tol) ||
+                                         (errs(domIdx, 0).m_absolute < abs_err_tol));
+                    localIters[domIdx]++;
+                    publish_bcState(domIdx);
+
+                    for (const auto neighDomIdx : tiling.exchDomIdVec()[domIdx]) {
+                        if (neighDomIdx != -1) { request(neighDomIdx); }
+                    }
+                    if (!converged[domIdx]) { request(domIdx); }
+                }
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(failureMutex);
+                if (!failed.exchange(true)) { failure = std::current_exception(); }
+            }
+
+            // requests made while this task ran are served by a new one
+            if (requests[domIdx].fetch_sub(served) != served) {
+                pool.detach_task([&task, domIdx]{ task(domIdx); });
+            }
+        };
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            request(domIdx);
+        }
+        pool.wait();
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+
+        Errors totalErrs = {};
+        int maxIters = 0;
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            reduce_errors(totalErrs, errs(domIdx, 0));
+            maxIters = std::max(maxIters, localIters[domIdx]);
+        }
+        finalize_errors(totalErrs, ndomains);
+        m_ae = totalErrs.m_absolute;
+        m_re = totalErrs.m_relative;
+        std::cout << "Asynchronous Schwarz, max subdomain iterations " << maxIters << "\n";
+        std::cout << error_label() << " abs err: " << m_ae << "\n";
+        std::cout << error_label() << " rel err: " << m_re << '\n';
+
+        return maxIters;
+    }
+
+    [[nodiscard]] int calc_controller_step(
+        SchwarzMode mode,
+        int outerStep,
+        double currentTime,
+        const double rel_err_tol,
+        const double abs_err_tol,
+        const int convergeStepMax,
+        BS::thread_pool & pool)
+    {
+        switch (mode)
+        {
+            case SchwarzMode::Additive:
+                return additive_step(outerStep, currentTime, rel_err_tol, abs_err_tol, convergeStepMax, pool);
+            case SchwarzMode::MultiplicativeColored:
+                return multiplicative_step(outerStep, currentTime, rel_err_tol, abs_err_tol, convergeStepMax, pool);
+            case SchwarzMode::Asynchronous:
+                return asynchronous_step(outerStep, currentTime, rel_err_tol, abs_err_tol, convergeStepMax, pool);
+            default:
+                // plain multiplicative Schwarz is inherently sequential
+                return calc_controller_step(mode, outerStep, currentTime, rel_err_tol, abs_err_tol, convergeStepMax);
+        }
+    }
+
     [[nodiscard]] int calc_controller_step(
         SchwarzMode mode,
         int outerStep,
@@ -912,13 +1695,37 @@ public:
         const double abs_err_tol,
         const int convergeStepMax)
     {
+        if (mode == SchwarzMode::Asynchronous) {
+            throw std::runtime_error("Asynchronous Schwarz requires a thread pool");
+        }
+
         const bool additive = (mode==SchwarzMode::Additive);
         const auto & tiling = *m_tiling;
         const auto ndomains = tiling.count();
 
+        // colored multiplicative Schwarz sweeps through subdomains one color at a time
+        std::vector<int> sweepOrder;
+        if (mode == SchwarzMode::MultiplicativeColored) {
+            for (const auto & domIds : tiling.colorDomIdVec()) {
+                sweepOrder.insert(sweepOrder.end(), domIds.begin(), domIds.end());
+            }
+        }
+        else {
+            for (int domIdx = 0; domIdx < ndomains; ++domIdx) { sweepOrder.push_back(domIdx); }
+        }
+
+        // additive Schwarz breaks before broadcasting its last iteration
+        if (additive && has_predictor()) {
+            for (int domIdx = 0; domIdx < ndomains; ++domIdx) { broadcast_bcState(domIdx); }
+        }
+
         // store initial step for resetting if Schwarz iter does not converge
-        for (int domIdx = 0; domIdx < ndomains; ++domIdx) { m_subdomainVec[domIdx]->storeStateHistory(0); }
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            m_subdomainVec[domIdx]->storeStateHistory(0);
+            predict_bcState(domIdx);
+        }
 
+        std::vector<char> active(ndomains, 1);
         int convergeStep = 0;
 
         while (convergeStep < convergeStepMax)
@@ -926,19 +1733,21 @@ public:
             Errors myerrs = {};
             std::cout << "Schwarz iteration " << convergeStep + 1 << '\n';
 
-            for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
-                domainControlLoop(domIdx, currentTime, outerStep, myerrs);
+            for (const auto domIdx : sweepOrder) {
+                active[domIdx] = timed_iterate(domIdx, currentTime, outerStep, convergeStep, myerrs);
 
                 // broadcast boundary conditions immediately for multiplicative Schwarz
-                if (!additive) { broadcast_bcState(domIdx); }
+                if (!additive && active[domIdx]) { broadcast_bcState(domIdx); }
 
             }
+            print_active_count(active);
 
             // // check convergence for all domains, break if conditions met
-            myerrs.m_absolute /= ndomains;
-            myerrs.m_relative /= ndomains;
-            std::cout << "Average abs err: " << myerrs.m_absolute << '\n';
-            std::cout << "Average rel err: " << myerrs.m_relative << '\n';
+            finalize_errors(myerrs, active_count(active));
+            m_ae = myerrs.m_absolute;
+            m_re = myerrs.m_relative;
+            std::cout << error_label() << " abs err: " << myerrs.m_absolute << '\n';
+            std::cout << error_label() << " rel err: " << myerrs.m_relative << '\n';
             if ((myerrs.m_relative < rel_err_tol) || (myerrs.m_absolute < abs_err_tol)) {
                 break;
             }
@@ -946,45 +1755,411 @@ public:
             // broadcast boundary conditions after domain cycle for additive Schwarz
             if (additive) {
                 for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
-                    broadcast_bcState(domIdx);
+                    if (active[domIdx]) { broadcast_bcState(domIdx); }
                 }
             }
             convergeStep++;
 
-            for (int domIdx = 0; domIdx < ndomains; ++domIdx){
-                m_subdomainVec[domIdx]->resetStateFromHistory();
-            }
-
         } // convergence loop
 
         // break is before counter increments
         return convergeStep + 1;
     }
 
-private:
+    void set_convergence_metric(const ConvergenceMetric metric,
+                                const ErrorReduction reduction = ErrorReduction::Average)
+    {
+        m_convergenceMetric = metric;
+        m_errReduction = reduction;
+    }
+
+    // accelerate the update of each subdomain's boundary state between Schwarz iterations
+    // depth is the Anderson window, relax the initial Aitken / Anderson relaxation factor,
+    //      omegaMax the bound on the magnitude of the Aitken relaxation factor
+    void set_interface_accelerator(const InterfaceAccel type, const int depth = 5, const double relax = 1.0,
+                                   const double omegaMax = 2.0)
+    {
+        m_accelVec.clear();
+        m_accelVec.resize(m_tiling->count());
+        for (int domIdx = 0; domIdx < m_tiling->count(); ++domIdx) {
+            m_accelVec[domIdx] = create_interface_accelerator<state_t>(type, depth, relax, omegaMax);
+        }
+    }
+
+    // start each outer step from boundary states extrapolated from the converged ones
+    //      of the last one (Linear) or two (Quadratic) outer steps
+    void set_interface_predictor(const InterfacePredict type)
+    {
+        m_predictVec.clear();
+        m_predictVec.resize(m_tiling->count());
+        for (int domIdx = 0; domIdx < m_tiling->count(); ++domIdx) {
+            m_predictVec[domIdx] = create_interface_predictor<state_t>(type);
+        }
+    }
+
+    // subdomains whose incoming boundary data changed by less than tol (relative, squared)
+    //      since their last solve are frozen, i.e. neither reset, re-solved, nor broadcast
+    // a non-positive tol disables freezing
+    void set_freeze_tolerance(const double tol)
+    {
+        m_freezeTol = tol;
+        m_stateBCsSnapshotVec.resize(m_tiling->count());
+        m_backStaleVec.assign(m_tiling->count(), 1);
+    }
+
+    // hyper-reduced subdomains drop their full-mesh basis and only rebuild
+    //      the full-mesh state when getStateFull() is called, noop for FOM/ROM subdomains
+    void set_lazy_full_state(const bool lazy)
+    {
+        for (int domIdx = 0; domIdx < m_tiling->count(); ++domIdx) {
+            if (m_ownedVec[domIdx]) {
+                m_subdomainVec[domIdx]->setLazyFullState(lazy);
+            }
+        }
+    }
+
+    // records per-subdomain phase timers and linear solver counts from now on,
+    //      trace additionally keeps every timed phase for write_chrome_trace()
+    Instrumentation & enable_instrumentation(const bool trace = false)
+    {
+        m_instrumentation = std::make_unique<Instrumentation>(m_tiling->count(), trace);
+        return *m_instrumentation;
+    }
+
+    // writes the estimated cost of one Schwarz iteration of each subdomain per full-mesh cell,
+    //      one line per subdomain, learned from the measured solve times of every step mode once any step has run
+    // create_decomp_meshes.py --domCostFile sizes the slabs of a new decomposition from it
+    void write_domain_costs(const std::string & fileName) const
+    {
+        std::ofstream outfile(fileName);
+        if (!outfile) {
+            throw std::runtime_error("Could not open " + fileName);
+        }
+        outfile << std::scientific << std::setprecision(8);
+        for (int domIdx = 0; domIdx < m_tiling->count(); ++domIdx) {
+            outfile << m_domainCostVec[domIdx] / m_subdomainVec[domIdx]->getMeshFull().sampleMeshSize() << "\n";
+        }
+    }
+
+    // writes the state of the decomposition after outer step outerStep (at time) to a single file
+    // hyper-reduced full states are not stored, as they are reconstructed from the reduced state
+    void write_checkpoint(const std::string & fileName, const int outerStep, const double time)
+    {
+        write_checkpoint_impl(nullptr, fileName, outerStep, time);
+    }
+
+    // same as above, subdomain blocks are written concurrently on the thread pool
+    void write_checkpoint(BS::thread_pool & pool, const std::string & fileName,
+                          const int outerStep, const double time)
+    {
+        write_checkpoint_impl(&pool, fileName, outerStep, time);
+    }
+
+    // restores a decomposition set up identically to the one that wrote fileName,
+    //      returns the outer step and time at which the checkpoint was written
+    std::tuple<int, double> read_checkpoint(const std::string & fileName)
+    {
+        return read_checkpoint_impl(nullptr, fileName);
+    }
+
+    // same as above, subdomain blocks are read concurrently on the thread pool
+    std::tuple<int, double> read_checkpoint(BS::thread_pool & pool, const std::string & fileName)
+    {
+        return read_checkpoint_impl(&pool, fileName);
+    }
+
+protected:
+    using scalar_t = typename state_t::Scalar;
+
+    void write_checkpoint_impl(BS::thread_pool * pool, const std::string & fileName,
+                               const int outerStep, const double time)
+    {
+        const int ndomains = m_tiling->count();
+
+        CheckpointHeader header;
+        header.m_scalarBytes = sizeof(scalar_t);
+        header.m_ndomains = ndomains;
+        header.m_outerStep = outerStep;
+        header.m_time = time;
+
+        // offset table is known up front, so every subdomain can write its own block
+        std::vector<CheckpointEntry> entries(ndomains);
+        std::uint64_t offset = sizeof(CheckpointHeader) + ndomains * sizeof(CheckpointEntry);
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            auto & entry = entries[domIdx];
+            entry.m_controlIters = m_controlItersVec[domIdx];
+            entry.m_stepCount = static_cast<std::uint64_t>(outerStep) * m_controlItersVec[domIdx];
+            entry.m_stencilSize = m_subdomainVec[domIdx]->getStateStencil()->size();
+            entry.m_reducedSize = m_subdomainVec[domIdx]->hasReducedState() ? m_subdomainVec[domIdx]->getStateReduced()->size() : 0;
+            entry.m_bcSize = m_subdomainVec[domIdx]->getStateBCs()->size();
+            entry.m_offset = offset;
+            offset += (entry.m_stencilSize + entry.m_reducedSize + entry.m_bcSize) * sizeof(scalar_t);
+        }
+
+        const int fd = ::open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd == -1) {
+            throw std::runtime_error("Cannot open checkpoint file " + fileName + ": " + strerror(errno));
+        }
+        try {
+            pwrite_all(fd, &header, sizeof(CheckpointHeader), 0);
+            pwrite_all(fd, entries.data(), ndomains * sizeof(CheckpointEntry), sizeof(CheckpointHeader));
+            for_each_domain(pool, [&](const int domIdx) {
+                const auto & entry = entries[domIdx];
+                auto & subdomain = *m_subdomainVec[domIdx];
+                off_t blockOffset = entry.m_offset;
+                pwrite_all(fd, subdomain.getStateStencil()->data(), entry.m_stencilSize * sizeof(scalar_t), blockOffset);
+                blockOffset += entry.m_stencilSize * sizeof(scalar_t);
+                if (entry.m_reducedSize > 0) {
+                    pwrite_all(fd, subdomain.getStateReduced()->data(), entry.m_reducedSize * sizeof(scalar_t), blockOffset);
+                    blockOffset += entry.m_reducedSize * sizeof(scalar_t);
+                }
+                pwrite_all(fd, subdomain.getStateBCs()->data(), entry.m_bcSize * sizeof(scalar_t), blockOffset);
+            });
+        }
+        catch (...) {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);
+    }
+
+    std::tuple<int, double> read_checkpoint_impl(BS::thread_pool * pool, const std::string & fileName)
+    {
+        const int ndomains = m_tiling->count();
+
+        const int fd = ::open(fileName.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw std::runtime_error("Cannot open checkpoint file " + fileName + ": " + strerror(errno));
+        }
+        CheckpointHeader header;
+        std::vector<CheckpointEntry> entries(ndomains);
+        try {
+            const CheckpointHeader expected;
+            pread_all(fd, &header, sizeof(CheckpointHeader), 0);
+            if (std::memcmp(header.m_magic, expected.m_magic, sizeof(header.m_magic)) != 0) {
+                throw std::runtime_error("Not a Schwarz checkpoint file: " + fileName);
+            }
+            if ((header.m_version != expected.m_version) || (header.m_scalarBytes != sizeof(scalar_t))) {
+                throw std::runtime_error("Incompatible checkpoint version or scalar type: " + fileName);
+            }
+            if (header.m_ndomains != static_cast<std::uint64_t>(ndomains)) {
+                throw std::runtime_error("Checkpoint has " + std::to_string(header.m_ndomains) +
+                    " subdomains, decomposition has " + std::to_string(ndomains));
+            }
+            if (header.m_outerStep < 0) {
+                throw std::runtime_error("Checkpoint has invalid outer step " + std::to_string(header.m_outerStep));
+            }
+            pread_all(fd, entries.data(), ndomains * sizeof(CheckpointEntry), sizeof(CheckpointHeader));
+
+            struct stat sb;
+            if (::fstat(fd, &sb) == -1) {
+                throw std::runtime_error("Cannot stat checkpoint file " + fileName + ": " + strerror(errno));
+            }
+            const std::uint64_t fileBytes = sb.st_size;
+            const std::uint64_t dataStart = sizeof(CheckpointHeader) + ndomains * sizeof(CheckpointEntry);
+
+            // validate everything before touching any subdomain state
+            for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+                const auto & entry = entries[domIdx];
+                auto & subdomain = *m_subdomainVec[domIdx];
+                const std::uint64_t reducedSize = subdomain.hasReducedState() ? subdomain.getStateReduced()->size() : 0;
+                const auto check = [&](const char * name, std::uint64_t stored, std::uint64_t expected) {
+                    if (stored != expected) {
+                        throw std::runtime_error("Checkpoint " + std::string(name) + " of subdomain " +
+                            std::to_string(domIdx) + " is " + std::to_string(stored) +
+                            ", decomposition expects " + std::to_string(expected));
+                    }
+                };
+                check("control iterations", entry.m_controlIters, m_controlItersVec[domIdx]);
+                check("step count", entry.m_stepCount, header.m_outerStep * entry.m_controlIters);
+                check("stencil state size", entry.m_stencilSize, subdomain.getStateStencil()->size());
+                check("reduced state size", entry.m_reducedSize, reducedSize);
+                check("boundary state size", entry.m_bcSize, subdomain.getStateBCs()->size());
+
+                const std::uint64_t blockBytes = (entry.m_stencilSize + entry.m_reducedSize + entry.m_bcSize) * sizeof(scalar_t);
+                if ((entry.m_offset < dataStart) || (entry.m_offset + blockBytes > fileBytes)) {
+                    throw std::runtime_error("Checkpoint block of subdomain " + std::to_string(domIdx) +
+                        " lies outside of " + fileName + " (" + std::to_string(fileBytes) + " bytes)");
+                }
+            }
+
+            for_each_domain(pool, [&](const int domIdx) {
+                const auto & entry = entries[domIdx];
+                auto & subdomain = *m_subdomainVec[domIdx];
+                off_t blockOffset = entry.m_offset;
+                pread_all(fd, subdomain.getStateStencil()->data(), entry.m_stencilSize * sizeof(scalar_t), blockOffset);
+                blockOffset += entry.m_stencilSize * sizeof(scalar_t);
+                if (entry.m_reducedSize > 0) {
+                    pread_all(fd, subdomain.getStateReduced()->data(), entry.m_reducedSize * sizeof(scalar_t), blockOffset);
+                    blockOffset += entry.m_reducedSize * sizeof(scalar_t);
+                }
+                pread_all(fd, subdomain.getStateBCs()->data(), entry.m_bcSize * sizeof(scalar_t), blockOffset);
+                *subdomain.getStateBCsBack() = *subdomain.getStateBCs();
+
+                // as at the end of a solved outer step, the last Schwarz iterate is the current state
+                subdomain.storeStateHistory(m_controlItersVec[domIdx]);
+            });
+        }
+        catch (...) {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);
+
+        // the restored boundary states do not continue the predictor history
+        for (auto & predictor : m_predictVec) {
+            if (predictor) { predictor->clear(); }
+        }
+
+        return {static_cast<int>(header.m_outerStep), header.m_time};
+    }
+
+    bool has_predictor() const
+    {
+        return std::any_of(m_predictVec.begin(), m_predictVec.end(), [](const auto & predictor) { return bool(predictor); });
+    }
+
+    // overwrites the boundary state of domIdx with the prediction for the new outer step
+    // the predictor history must hold the converged interface states, so additive steps first send
+    //      the final states of the last outer step, which they do not send when converging
+    void predict_bcState(const int domIdx)
+    {
+        if (!m_predictVec.empty() && m_predictVec[domIdx]) {
+            PhaseTimer timer(m_instrumentation.get(), domIdx, Phase::Predict);
+            m_predictVec[domIdx]->predict(*m_subdomainVec[domIdx]->getStateBCs());
+        }
+    }
+
+    bool isDomainFrozen(int domIdx, int convergeStep)
+    {
+        if ((m_freezeTol <= 0.0) || (convergeStep == 0)) {
+            return false;
+        }
+        const auto bcChange = calcConvergence(m_stateBCsSnapshotVec[domIdx],
+                                              *m_subdomainVec[domIdx]->getStateBCs());
+        return (bcChange[1] < m_freezeTol);
+    }
+
+    // one Schwarz iteration of a single subdomain, returns false if the subdomain was frozen
+    bool domainIterate(int domIdx, double currentTime, int outerStep, int convergeStep, Errors & errors)
+    {
+        if (!domainBeginIterate(domIdx, convergeStep)) {
+            return false;
+        }
+        domainControlLoop(domIdx, currentTime, outerStep, errors);
+        return true;
+    }
+
+    // boundary and initial state of a Schwarz iteration, returns false if the subdomain is frozen
+    bool domainBeginIterate(int domIdx, int convergeStep)
+    {
+        if (isDomainFrozen(domIdx, convergeStep)) {
+            // unchanged inputs would reproduce the current solution, so it contributes no error
+            return false;
+        }
+
+        if (!m_accelVec.empty() && m_accelVec[domIdx]) {
+            PhaseTimer timer(m_instrumentation.get(), domIdx, Phase::Accelerate);
+            if (convergeStep == 0) {
+                m_accelVec[domIdx]->reset(*m_subdomainVec[domIdx]->getStateBCs());
+            }
+            else {
+                m_accelVec[domIdx]->apply(*m_subdomainVec[domIdx]->getStateBCs());
+            }
+        }
+
+        if (convergeStep > 0) {
+            PhaseTimer timer(m_instrumentation.get(), domIdx, Phase::ResetHistory);
+            m_subdomainVec[domIdx]->resetStateFromHistory();
+        }
+        if (m_freezeTol > 0.0) {
+            m_stateBCsSnapshotVec[domIdx] = *m_subdomainVec[domIdx]->getStateBCs();
+        }
+        return true;
+    }
+
+    // number of subdomains the averaged errors are taken over
+    int active_count(const std::vector<char> & active) const
+    {
+        return std::max(1, (int) std::count(active.begin(), active.end(), 1));
+    }
+
+    // whether domIdx must broadcast into its neighbors' back buffers in double-buffered iterations
+    // a frozen subdomain broadcasts once more after its last solve, after which both buffers hold
+    //      its current state, and is skipped from then on. Accelerators rewrite the front buffers,
+    //      so with accelerators every subdomain broadcasts.
+    bool needs_back_broadcast(const int domIdx, const bool active)
+    {
+        if ((m_freezeTol <= 0.0) || has_accelerator()) {
+            return true;
+        }
+        const bool stale = m_backStaleVec[domIdx];
+        m_backStaleVec[domIdx] = active;
+        return active || stale;
+    }
+
+    bool has_accelerator() const
+    {
+        return std::any_of(m_accelVec.begin(), m_accelVec.end(), [](const auto & accel) { return bool(accel); });
+    }
+
+    void print_active_count(const std::vector<char> & active)
+    {
+        if (m_freezeTol > 0.0) {
+            std::cout << "Active subdomains: " << std::count(active.begin(), active.end(), 1) << "\n";
+        }
+    }
+
     void domainControlLoop(int domIdx, double currentTime, int outerStep, Errors & errors)
     {
         auto timeDom = currentTime;
         auto stepDom = outerStep * m_controlItersVec[domIdx];
         const auto dtDom = m_dt[domIdx];
-        const auto dtWrap = pode::StepSize<double>(dtDom);
 
         for (int innerStep = 0; innerStep < m_controlItersVec[domIdx]; ++innerStep) {
-            const auto startTimeWrap = pode::StepStartAt<double>(timeDom);
-            const auto stepWrap = pode::StepCount(stepDom);
-            m_subdomainVec[domIdx]->doStep(startTimeWrap, stepWrap, dtWrap);
-            m_subdomainVec[domIdx]->updateFullState(); // noop for FOM subdomain
+            domainInnerStep(domIdx, innerStep, timeDom, stepDom, errors);
+            stepDom++;
+            timeDom += dtDom;
+        }
+    }
+
+    // single controller step of a subdomain, the convergence error is measured after the last one
+    void domainInnerStep(int domIdx, int innerStep, double timeDom, int stepDom, Errors & errors)
+    {
+        const auto dtWrap = pode::StepSize<double>(m_dt[domIdx]);
+        const auto startTimeWrap = pode::StepStartAt<double>(timeDom);
+        const auto stepWrap = pode::StepCount(stepDom);
+        auto * instr = m_instrumentation.get();
+        auto & subdomain = *m_subdomainVec[domIdx];
 
-            if (innerStep == (m_controlItersVec[domIdx] - 1)) {
-                const auto my_converge = calcConvergence(*m_subdomainVec[domIdx]->getStateStencil(),
-                                                         m_subdomainVec[domIdx]->getLastStateInHistory());
-                errors.m_absolute += my_converge[0];
-                errors.m_relative += my_converge[1];
+        {
+            PhaseTimer timer(instr, domIdx, Phase::Step);
+            const auto statsStart = instr ? subdomain.getSolverStats() : SolverStats{};
+            subdomain.doStep(startTimeWrap, stepWrap, dtWrap);
+            if (instr) {
+                const auto statsDelta = subdomain.getSolverStats() - statsStart;
+                instr->add_solver_stats(domIdx, statsDelta);
+                timer.set_count(statsDelta.m_solves);
             }
+        }
+        {
+            PhaseTimer timer(instr, domIdx, Phase::UpdateFullState);
+            subdomain.updateFullState(); // noop for FOM subdomain
+        }
 
-            m_subdomainVec[domIdx]->storeStateHistory(innerStep+1);
-            stepDom++;
-            timeDom += dtDom;
+        if (innerStep == (m_controlItersVec[domIdx] - 1)) {
+            PhaseTimer timer(instr, domIdx, Phase::Convergence);
+            const auto & state = *subdomain.getStateStencil();
+            const auto & stateLast = subdomain.getLastStateInHistory();
+            const auto my_converge = (m_convergenceMetric == ConvergenceMetric::Interface)
+                ? calcInterfaceConvergence(domIdx, state, stateLast)
+                : calcConvergence(state, stateLast);
+            reduce_errors(errors, {my_converge[1], my_converge[0]});
+        }
+
+        {
+            PhaseTimer timer(instr, domIdx, Phase::StoreHistory);
+            subdomain.storeStateHistory(innerStep+1);
         }
     }
 
@@ -994,13 +2169,31 @@ public:
     int m_dofPerCell;
     std::shared_ptr<const Tiling> m_tiling;
     std::vector<std::shared_ptr<subdomain_base_t>> & m_subdomainVec;
+    std::vector<char> m_ownedVec;          // subdomains solved by this process
     double m_dtMax;
     std::vector<double> m_dt;
     std::vector<std::vector<std::vector<std::array<int, 2>>>> m_broadcastGraphVec;
+    std::vector<ExchangePlan> m_exchPlanVec;
     std::vector<std::vector<graph_t>> m_ghostGraphVec;
     std::vector<int> m_controlItersVec;
+    std::vector<std::vector<std::unique_ptr<InterfaceBuffer>>> m_interfaceBufferVec;
+    double m_freezeTol = -1.0;
+    ConvergenceMetric m_convergenceMetric = ConvergenceMetric::FullState;
+    ErrorReduction m_errReduction = ErrorReduction::Average;
+    std::vector<state_t> m_stateBCsSnapshotVec;
+    std::vector<char> m_backStaleVec;      // neighbors' back buffers hold older data than the current state
+    std::vector<std::unique_ptr<InterfaceAcceleratorBase<state_t>>> m_accelVec;
+    std::vector<std::unique_ptr<InterfacePredictor<state_t>>> m_predictVec;
+    BS::thread_pool * m_setupPool = nullptr;
+    std::vector<std::pair<std::string, double>> m_setupTimes;
+    std::unique_ptr<Instrumentation> m_instrumentation;
+    std::vector<double> m_domainCostVec;   // seconds per Schwarz iteration, estimated
+    double m_costWeight = 0.3;             // weight of the newest measurement in m_domainCostVec
+    std::vector<int> m_allDomIds;
+    std::vector<int> m_scheduleOrder;
     double m_ae;
     double m_re;
+    int m_activeCount = 0;
 };
 }
 
@@ -0,0 +1,707 @@
+//@HEADER
+// ************************************************************************
+//
+//                     		       Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Chris Wentland (crwentl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PRESSIODEMOAPPS_SCHWARZ_MPI_HPP_
+#define PRESSIODEMOAPPS_SCHWARZ_MPI_HPP_
+
+#if defined SCHWARZ_ENABLE_MPI
+
+#include <mpi.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <type_traits>
+#include "./schwarz.hpp"
+
+
+namespace pschwarz{
+
+template<class scalar_t>
+MPI_Datatype mpi_datatype()
+{
+    if constexpr (std::is_same_v<scalar_t, double>) { return MPI_DOUBLE; }
+    else if constexpr (std::is_same_v<scalar_t, float>) { return MPI_FLOAT; }
+    else { static_assert(std::is_same_v<scalar_t, double>, "unsupported MPI scalar type"); }
+}
+
+// owner rank of each subdomain: contiguous blocks of subdomains, sizes differing by at most one
+inline std::vector<int> mpi_domain_owners(const Tiling & tiling, MPI_Comm comm = MPI_COMM_WORLD)
+{
+    int nranks;
+    MPI_Comm_size(comm, &nranks);
+    const int ndomains = tiling.count();
+    if (nranks > ndomains) {
+        throw std::runtime_error("SchwarzDecompMPI needs at least one subdomain per rank");
+    }
+    std::vector<int> ownerVec(ndomains);
+    for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+        ownerVec[domIdx] = static_cast<int>((static_cast<long>(domIdx) * nranks) / ndomains);
+    }
+    return ownerVec;
+}
+
+// subdomains owned by the calling rank, for create_owned_subdomains()
+inline std::vector<char> mpi_owned_domains(const Tiling & tiling, MPI_Comm comm = MPI_COMM_WORLD)
+{
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    const auto ownerVec = mpi_domain_owners(tiling, comm);
+    std::vector<char> ownedVec(ownerVec.size());
+    for (std::size_t domIdx = 0; domIdx < ownerVec.size(); ++domIdx) {
+        ownedVec[domIdx] = (ownerVec[domIdx] == rank);
+    }
+    return ownedVec;
+}
+
+//
+// Schwarz decomposition distributed over the ranks of an MPI communicator.
+// Each rank solves a contiguous block of subdomains. Interface data between subdomains
+// on different ranks is packed into one buffer per (subdomain, neighbor) pair and exchanged
+// with non-blocking point-to-point messages, interface data between subdomains on the same
+// rank is copied directly. Convergence errors are combined with an allreduce.
+//
+// Each rank only sets up the subdomains it owns (see mpi_owned_domains). The others are only
+// used for their interface connectivity, which every rank computes from the meshes and sample
+// cells, so that both ends of every message agree on its layout without further communication.
+// They should be SubdomainInterface stand-ins, built by create_owned_subdomains().
+// Messages go over a duplicate of the given communicator.
+//
+template<class ...SubdomainArgs>
+class SchwarzDecompMPI : public SchwarzDecomp<SubdomainArgs...>
+{
+    using base_t = SchwarzDecomp<SubdomainArgs...>;
+
+public:
+    using subdomain_base_t = typename base_t::subdomain_base_t;
+    using state_t = typename base_t::state_t;
+    using scalar_t = std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<state_t &>().data())>>;
+
+    SchwarzDecompMPI(std::vector<std::shared_ptr< SubdomainBase<SubdomainArgs...> >> & subdomains,
+                     std::shared_ptr<const Tiling> tiling,
+                     std::vector<double> & dtVec,
+                     MPI_Comm comm = MPI_COMM_WORLD)
+        : base_t(subdomains, tiling, dtVec, mpi_owned_domains(*tiling, comm))
+    {
+        MPI_Comm_dup(comm, &m_comm);
+        MPI_Comm_rank(m_comm, &m_rank);
+        MPI_Comm_size(m_comm, &m_nranks);
+        assign_ranks();
+        calc_messages();
+
+        // first communication, the base class only reached neighbors on this rank
+        exchange_bcState(std::vector<char>(tiling->count(), 1));
+        for (const int domIdx : m_localDomIds) {
+            *this->m_subdomainVec[domIdx]->getStateBCsBack() = *this->m_subdomainVec[domIdx]->getStateBCs();
+        }
+    }
+
+    SchwarzDecompMPI(const SchwarzDecompMPI &) = delete;
+    SchwarzDecompMPI & operator=(const SchwarzDecompMPI &) = delete;
+
+    ~SchwarzDecompMPI()
+    {
+        int finalized;
+        MPI_Finalized(&finalized);
+        if (!finalized) {
+            MPI_Comm_free(&m_comm);
+        }
+    }
+
+    int rank() const { return m_rank; }
+    int rank_count() const { return m_nranks; }
+    int owner(const int domIdx) const { return m_ownerVec[domIdx]; }
+    bool is_local(const int domIdx) const { return m_ownerVec[domIdx] == m_rank; }
+    const std::vector<int> & local_domains() const { return m_localDomIds; }
+
+    int additive_step(int outerStep, double currentTime,
+                      const double rel_err_tol, const double abs_err_tol,
+                      const int convergeStepMax)
+    {
+        const int ndomains = this->m_tiling->count();
+        const std::vector<char> allSenders(ndomains, 1);
+
+        // the last iteration of the previous step was not exchanged, see predict_bcState
+        if (this->has_predictor()) {
+            exchange_bcState(allSenders);
+        }
+        for (const int domIdx : m_localDomIds) {
+            this->m_subdomainVec[domIdx]->storeStateHistory(0);
+            this->predict_bcState(domIdx);
+        }
+
+        std::vector<char> active(ndomains, 1);
+        int convergeStep = 0;
+        while (convergeStep < convergeStepMax) {
+            Errors localErrs = {};
+            for (const int domIdx : m_localDomIds) {
+                active[domIdx] = this->timed_iterate(domIdx, currentTime, outerStep, convergeStep, localErrs);
+            }
+
+            const auto totalErrs = allreduce_errors(localErrs, active);
+            if (m_rank == 0) {
+                std::cout << "Schwarz iteration " << convergeStep + 1 << "\n";
+                std::cout << this->error_label() << " abs err: " << totalErrs.m_absolute << "\n";
+                std::cout << this->error_label() << " rel err: " << totalErrs.m_relative << '\n';
+            }
+            if ((totalErrs.m_relative < rel_err_tol) || (totalErrs.m_absolute < abs_err_tol)) {
+                break;
+            }
+
+            // every subdomain sends, frozen ones included, as receivers can not know which are frozen
+            exchange_bcState(allSenders);
+            convergeStep++;
+        }
+
+        // breaks before counter increments
+        return convergeStep + 1;
+    }
+
+    int multiplicative_step(int outerStep, double currentTime,
+                            const double rel_err_tol, const double abs_err_tol,
+                            const int convergeStepMax)
+    {
+        const auto & tiling = *this->m_tiling;
+        const int ndomains = tiling.count();
+
+        for (const int domIdx : m_localDomIds) {
+            this->m_subdomainVec[domIdx]->storeStateHistory(0);
+            this->predict_bcState(domIdx);
+        }
+
+        // one exchange per color, with the subdomains of that color as senders
+        std::vector<std::vector<char>> colorSenders(tiling.colorCount(), std::vector<char>(ndomains, 0));
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            colorSenders[tiling.color(domIdx)][domIdx] = 1;
+        }
+
+        std::vector<char> active(ndomains, 1);
+        int convergeStep = 0;
+        while (convergeStep < convergeStepMax) {
+            Errors localErrs = {};
+            for (int colorIdx = 0; colorIdx < tiling.colorCount(); ++colorIdx) {
+                for (const int domIdx : tiling.colorDomIdVec()[colorIdx]) {
+                    if (is_local(domIdx)) {
+                        active[domIdx] = this->timed_iterate(domIdx, currentTime, outerStep, convergeStep, localErrs);
+                    }
+                }
+                exchange_bcState(colorSenders[colorIdx]);
+            }
+
+            const auto totalErrs = allreduce_errors(localErrs, active);
+            if (m_rank == 0) {
+                std::cout << "Schwarz iteration " << convergeStep + 1 << "\n";
+                std::cout << this->error_label() << " abs err: " << totalErrs.m_absolute << "\n";
+                std::cout << this->error_label() << " rel err: " << totalErrs.m_relative << '\n';
+            }
+            if ((totalErrs.m_relative < rel_err_tol) || (totalErrs.m_absolute < abs_err_tol)) {
+                break;
+            }
+            convergeStep++;
+        }
+
+        // breaks before counter increments
+        return convergeStep + 1;
+    }
+
+    [[nodiscard]] int calc_controller_step(
+        SchwarzMode mode,
+        int outerStep,
+        double currentTime,
+        const double rel_err_tol,
+        const double abs_err_tol,
+        const int convergeStepMax)
+    {
+        switch (mode)
+        {
+            case SchwarzMode::Additive:
+                return additive_step(outerStep, currentTime, rel_err_tol, abs_err_tol, convergeStepMax);
+            case SchwarzMode::MultiplicativeColored:
+                return multiplicative_step(outerStep, currentTime, rel_err_tol, abs_err_tol, convergeStepMax);
+            default:
+                throw std::runtime_error("SchwarzDecompMPI supports Additive and MultiplicativeColored Schwarz");
+        }
+    }
+
+    // Hybrid additive Schwarz: the local subdomains are solved on the thread pool, while the
+    //      calling thread sends the boundary data of each finished subdomain to other ranks and
+    //      unpacks arriving data. Local neighbors are written directly, without message buffers.
+    //      As in the thread pool additive step, all writes go to back buffers, swapped between iterations.
+    // MPI must be initialized with at least MPI_THREAD_FUNNELED
+    int additive_step(int outerStep, double currentTime,
+                      const double rel_err_tol, const double abs_err_tol,
+                      const int convergeStepMax, BS::thread_pool & pool)
+    {
+        check_funneled();
+        const int ndomains = this->m_tiling->count();
+        const int nlocal = m_localDomIds.size();
+        const std::vector<char> allSenders(ndomains, 1);
+
+        // the last iteration of the previous step went to the back buffers only, see predict_bcState
+        if (this->has_predictor()) {
+            exchange_bcState(allSenders);
+        }
+        for (const int domIdx : m_localDomIds) {
+            this->m_subdomainVec[domIdx]->storeStateHistory(0);
+            this->predict_bcState(domIdx);
+        }
+
+        Eigen::Matrix<Errors, -1, -1, Eigen::RowMajor> errs(ndomains, 16);
+        std::vector<char> active(ndomains, 1);
+        std::mutex readyMutex;
+        std::condition_variable readyCv;
+        std::vector<int> ready, readyBatch;
+        int convergeStep = 0;
+        while (convergeStep < convergeStepMax) {
+            for (const int domIdx : m_localDomIds) {
+                errs(domIdx, 0) = {};
+            }
+            post_receives(allSenders);
+
+            // failed tasks are reported as ready with index -1, so that the loop below ends
+            const auto markReady = [&](const int domIdx) {
+                {
+                    std::lock_guard<std::mutex> lock(readyMutex);
+                    ready.push_back(domIdx);
+                }
+                readyCv.notify_one();
+            };
+            BS::multi_future<void> futures;
+            for (const int domIdx : this->longest_first(m_localDomIds)) {
+                futures.push_back(pool.submit_task([&, domIdx] {
+                    try {
+                        active[domIdx] = this->timed_iterate(domIdx, currentTime, outerStep, convergeStep, errs(domIdx, 0));
+                        copy_to_local_neighbors(domIdx, true);
+                    }
+                    catch (...) {
+                        markReady(-1);
+                        throw;
+                    }
+                    markReady(domIdx);
+                }));
+            }
+
+            // communication, while the pool solves
+            int sent = 0;
+            while (sent < nlocal) {
+                {
+                    std::unique_lock<std::mutex> lock(readyMutex);
+                    readyCv.wait_for(lock, std::chrono::microseconds(50), [&]{ return !ready.empty(); });
+                    readyBatch.swap(ready);
+                }
+                for (const int domIdx : readyBatch) {
+                    if (domIdx >= 0) {
+                        post_sends(domIdx);
+                    }
+                    sent++;
+                }
+                readyBatch.clear();
+                progress_receives(true);
+            }
+            futures.wait();
+            abort_on_exception([&] { futures.get(); });
+            complete_exchange(true);
+
+            Errors localErrs = {};
+            for (const int domIdx : m_localDomIds) {
+                this->reduce_errors(localErrs, errs(domIdx, 0));
+            }
+            const auto totalErrs = allreduce_errors(localErrs, active);
+            if (m_rank == 0) {
+                std::cout << "Schwarz iteration " << convergeStep + 1 << "\n";
+                std::cout << this->error_label() << " abs err: " << totalErrs.m_absolute << "\n";
+                std::cout << this->error_label() << " rel err: " << totalErrs.m_relative << '\n';
+            }
+            if ((totalErrs.m_relative < rel_err_tol) || (totalErrs.m_absolute < abs_err_tol)) {
+                break;
+            }
+            convergeStep++;
+
+            for (const int domIdx : m_localDomIds) {
+                this->m_subdomainVec[domIdx]->swapStateBCs();
+            }
+        }
+
+        // breaks before counter increments
+        return convergeStep + 1;
+    }
+
+    // hybrid colored multiplicative Schwarz, local subdomains of one color are solved on the thread pool
+    int multiplicative_step(int outerStep, double currentTime,
+                            const double rel_err_tol, const double abs_err_tol,
+                            const int convergeStepMax, BS::thread_pool & pool)
+    {
+        check_funneled();
+        const auto & tiling = *this->m_tiling;
+        const int ndomains = tiling.count();
+
+        for (const int domIdx : m_localDomIds) {
+            this->m_subdomainVec[domIdx]->storeStateHistory(0);
+            this->predict_bcState(domIdx);
+        }
+
+        std::vector<std::vector<char>> colorSenders(tiling.colorCount(), std::vector<char>(ndomains, 0));
+        std::vector<std::vector<int>> localColorDomIds(tiling.colorCount());
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            colorSenders[tiling.color(domIdx)][domIdx] = 1;
+            if (is_local(domIdx)) {
+                localColorDomIds[tiling.color(domIdx)].push_back(domIdx);
+            }
+        }
+
+        Eigen::Matrix<Errors, -1, -1, Eigen::RowMajor> errs(ndomains, 16);
+        std::vector<char> active(ndomains, 1);
+        int convergeStep = 0;
+        while (convergeStep < convergeStepMax) {
+            for (const int domIdx : m_localDomIds) {
+                errs(domIdx, 0) = {};
+            }
+
+            for (int colorIdx = 0; colorIdx < tiling.colorCount(); ++colorIdx) {
+                abort_on_exception([&] {
+                    this->run_schwarz_iteration(pool, localColorDomIds[colorIdx], currentTime, outerStep, convergeStep,
+                                                errs, active, [](int) {});
+                });
+                exchange_bcState(colorSenders[colorIdx]);
+            }
+
+            Errors localErrs = {};
+            for (const int domIdx : m_localDomIds) {
+                this->reduce_errors(localErrs, errs(domIdx, 0));
+            }
+            const auto totalErrs = allreduce_errors(localErrs, active);
+            if (m_rank == 0) {
+                std::cout << "Schwarz iteration " << convergeStep + 1 << "\n";
+                std::cout << this->error_label() << " abs err: " << totalErrs.m_absolute << "\n";
+                std::cout << this->error_label() << " rel err: " << totalErrs.m_relative << '\n';
+            }
+            if ((totalErrs.m_relative < rel_err_tol) || (totalErrs.m_absolute < abs_err_tol)) {
+                break;
+            }
+            convergeStep++;
+        }
+
+        // breaks before counter increments
+        return convergeStep + 1;
+    }
+
+    [[nodiscard]] int calc_controller_step(
+        SchwarzMode mode,
+        int outerStep,
+        double currentTime,
+        const double rel_err_tol,
+        const double abs_err_tol,
+        const int convergeStepMax,
+        BS::thread_pool & pool)
+    {
+        switch (mode)
+        {
+            case SchwarzMode::Additive:
+                return additive_step(outerStep, currentTime, rel_err_tol, abs_err_tol, convergeStepMax, pool);
+            case SchwarzMode::MultiplicativeColored:
+                return multiplicative_step(outerStep, currentTime, rel_err_tol, abs_err_tol, convergeStepMax, pool);
+            default:
+                throw std::runtime_error("SchwarzDecompMPI supports Additive and MultiplicativeColored Schwarz");
+        }
+    }
+
+private:
+
+    struct Message
+    {
+        int m_domIdx;      // sender
+        int m_neighIdx;    // neighbor index of the receiver, from the sender
+        int m_recvDomIdx;
+        int m_peer;        // rank at the other end
+        int m_tag;
+        std::vector<scalar_t> m_buffer;
+    };
+
+    // same assignment as the ownership flags the base class was set up with
+    void assign_ranks()
+    {
+        m_ownerVec = mpi_domain_owners(*this->m_tiling, m_comm);
+        for (int domIdx = 0; domIdx < (int) m_ownerVec.size(); ++domIdx) {
+            if (m_ownerVec[domIdx] == m_rank) {
+                m_localDomIds.push_back(domIdx);
+            }
+        }
+    }
+
+    // one message per (sender, neighbor) pair crossing ranks, in the layout of the sender's exchange plan
+    // tags number the messages between each pair of ranks, both ends count them in the same order
+    void calc_messages()
+    {
+        const auto & exchDomIdVec = this->m_tiling->exchDomIdVec();
+        const int ndomains = this->m_tiling->count();
+        m_sendIdsVec.resize(ndomains);
+
+        int * tagUbPtr = nullptr;
+        int hasTagUb = 0;
+        MPI_Comm_get_attr(m_comm, MPI_TAG_UB, &tagUbPtr, &hasTagUb);
+        const int tagUb = hasTagUb ? *tagUbPtr : 32767;  // lowest upper bound allowed by the standard
+        std::vector<int> sendTags(m_nranks, 0);
+        std::vector<int> recvTags(m_nranks, 0);
+        auto next_tag = [&](std::vector<int> & tags, const int peer) {
+            // tags are not wrapped around, as messages with equal tags could be matched out of order
+            if (tags[peer] > tagUb) {
+                throw std::runtime_error("More messages between ranks " + std::to_string(m_rank) + " and "
+                                         + std::to_string(peer) + " than MPI tags (" + std::to_string(tagUb) + ")");
+            }
+            return tags[peer]++;
+        };
+
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            const auto & plan = this->m_exchPlanVec[domIdx];
+            for (int neighIdx = 0; neighIdx < (int) exchDomIdVec[domIdx].size(); ++neighIdx) {
+                const int neighDomIdx = exchDomIdVec[domIdx][neighIdx];
+                if ((neighDomIdx == -1) || (owner(domIdx) == owner(neighDomIdx))) {
+                    continue;  // not a Schwarz BC, or no message needed
+                }
+
+                Message msg;
+                msg.m_domIdx = domIdx;
+                msg.m_neighIdx = neighIdx;
+                msg.m_recvDomIdx = neighDomIdx;
+                msg.m_buffer.resize((plan.m_offsets[neighIdx + 1] - plan.m_offsets[neighIdx]) * this->m_dofPerCell);
+                if (is_local(domIdx)) {
+                    msg.m_peer = owner(neighDomIdx);
+                    msg.m_tag = next_tag(sendTags, msg.m_peer);
+                    m_sendIdsVec[domIdx].push_back(m_sendVec.size());
+                    m_sendVec.push_back(std::move(msg));
+                }
+                else if (is_local(neighDomIdx)) {
+                    msg.m_peer = owner(domIdx);
+                    msg.m_tag = next_tag(recvTags, msg.m_peer);
+                    m_recvVec.push_back(std::move(msg));
+                }
+            }
+        }
+        m_sendRequests.assign(m_sendVec.size(), MPI_REQUEST_NULL);
+        m_recvRequests.assign(m_recvVec.size(), MPI_REQUEST_NULL);
+        m_completed.resize(m_recvVec.size());
+    }
+
+    // copies the boundary data of every sender into its neighbors' m_stateBCs
+    // senders must be the same on every rank
+    void exchange_bcState(const std::vector<char> & senders)
+    {
+        post_receives(senders);
+        for (const int domIdx : m_localDomIds) {
+            if (senders[domIdx]) {
+                post_sends(domIdx);
+            }
+        }
+
+        // neighbors on this rank are written while messages are in flight
+        for (const int domIdx : m_localDomIds) {
+            if (senders[domIdx]) {
+                copy_to_local_neighbors(domIdx, false);
+            }
+        }
+        complete_exchange(false);
+    }
+
+    void post_receives(const std::vector<char> & senders)
+    {
+        const auto type = mpi_datatype<scalar_t>();
+        for (std::size_t msgIdx = 0; msgIdx < m_recvVec.size(); ++msgIdx) {
+            auto & msg = m_recvVec[msgIdx];
+            if (senders[msg.m_domIdx]) {
+                MPI_Irecv(msg.m_buffer.data(), (int) msg.m_buffer.size(), type,
+                          msg.m_peer, msg.m_tag, m_comm, &m_recvRequests[msgIdx]);
+            }
+        }
+    }
+
+    // packs and sends the boundary data of local subdomain domIdx to its neighbors on other ranks
+    void post_sends(const int domIdx)
+    {
+        const auto type = mpi_datatype<scalar_t>();
+        const auto & plan = this->m_exchPlanVec[domIdx];
+        const auto * state = this->m_subdomainVec[domIdx]->getStateStencil();
+        for (const int msgIdx : m_sendIdsVec[domIdx]) {
+            auto & msg = m_sendVec[msgIdx];
+            const int start = plan.m_offsets[msg.m_neighIdx];
+            this->copy_blocks(state->data(), plan.m_source.data() + start,
+                              msg.m_buffer.data(), (const int *) nullptr,
+                              plan.m_offsets[msg.m_neighIdx + 1] - start);
+            MPI_Isend(msg.m_buffer.data(), (int) msg.m_buffer.size(), type,
+                      msg.m_peer, msg.m_tag, m_comm, &m_sendRequests[msgIdx]);
+        }
+    }
+
+    // shared memory exchange, straight from the state of domIdx into its neighbors on this rank
+    void copy_to_local_neighbors(const int domIdx, const bool toBack)
+    {
+        const auto & exchDomIdVec = this->m_tiling->exchDomIdVec();
+        const auto & plan = this->m_exchPlanVec[domIdx];
+        const auto * state = this->m_subdomainVec[domIdx]->getStateStencil();
+        for (int neighIdx = 0; neighIdx < (int) exchDomIdVec[domIdx].size(); ++neighIdx) {
+            const int neighDomIdx = exchDomIdVec[domIdx][neighIdx];
+            if ((neighDomIdx == -1) || !is_local(neighDomIdx)) {
+                continue;
+            }
+            auto * neighStateBCs = toBack ? this->m_subdomainVec[neighDomIdx]->getStateBCsBack()
+                                          : this->m_subdomainVec[neighDomIdx]->getStateBCs();
+            const int start = plan.m_offsets[neighIdx];
+            this->copy_blocks(state->data(), plan.m_source.data() + start,
+                              neighStateBCs->data(), plan.m_target.data() + start,
+                              plan.m_offsets[neighIdx + 1] - start);
+        }
+    }
+
+    // unpacks the receives that have arrived, without blocking
+    void progress_receives(const bool toBack)
+    {
+        if (m_recvRequests.empty()) {
+            return;
+        }
+        int count = 0;
+        MPI_Testsome((int) m_recvRequests.size(), m_recvRequests.data(), &count,
+                     m_completed.data(), MPI_STATUSES_IGNORE);
+        for (int idx = 0; (count != MPI_UNDEFINED) && (idx < count); ++idx) {
+            unpack(m_recvVec[m_completed[idx]], toBack);
+        }
+    }
+
+    // waits for and unpacks all outstanding receives, and waits for all sends
+    void complete_exchange(const bool toBack)
+    {
+        while (!m_recvRequests.empty()) {
+            int count = 0;
+            MPI_Waitsome((int) m_recvRequests.size(), m_recvRequests.data(), &count,
+                         m_completed.data(), MPI_STATUSES_IGNORE);
+            if (count == MPI_UNDEFINED) {
+                break;  // no active requests left
+            }
+            for (int idx = 0; idx < count; ++idx) {
+                unpack(m_recvVec[m_completed[idx]], toBack);
+            }
+        }
+        MPI_Waitall((int) m_sendRequests.size(), m_sendRequests.data(), MPI_STATUSES_IGNORE);
+    }
+
+    void unpack(const Message & msg, const bool toBack)
+    {
+        const auto & plan = this->m_exchPlanVec[msg.m_domIdx];
+        const int start = plan.m_offsets[msg.m_neighIdx];
+        auto * stateBCs = toBack ? this->m_subdomainVec[msg.m_recvDomIdx]->getStateBCsBack()
+                                 : this->m_subdomainVec[msg.m_recvDomIdx]->getStateBCs();
+        this->copy_blocks(msg.m_buffer.data(), (const int *) nullptr,
+                          stateBCs->data(), plan.m_target.data() + start,
+                          plan.m_offsets[msg.m_neighIdx + 1] - start);
+    }
+
+    // a subdomain solve failing on one rank would leave the others waiting for its messages,
+    //      so the exception is reported and all ranks are aborted
+    template<class F>
+    void abort_on_exception(F && f)
+    {
+        try {
+            f();
+        }
+        catch (const std::exception & e) {
+            std::cerr << "Rank " << m_rank << ": subdomain solve failed: " << e.what() << std::endl;
+            MPI_Abort(m_comm, 1);
+        }
+        catch (...) {
+            std::cerr << "Rank " << m_rank << ": subdomain solve failed" << std::endl;
+            MPI_Abort(m_comm, 1);
+        }
+    }
+
+    // the hybrid steps call MPI from the calling thread only, while pool threads solve
+    void check_funneled() const
+    {
+        int provided, isMain;
+        MPI_Query_thread(&provided);
+        MPI_Is_thread_main(&isMain);
+        if ((provided < MPI_THREAD_FUNNELED) || !isMain) {
+            throw std::runtime_error("Hybrid MPI Schwarz requires MPI_THREAD_FUNNELED, called from the main thread");
+        }
+    }
+
+    // active flags are only read for local subdomains, frozen ones are left out of the average
+    Errors allreduce_errors(const Errors & localErrs, const std::vector<char> & active)
+    {
+        double local[2] = {localErrs.m_absolute, localErrs.m_relative};
+        double total[2];
+        MPI_Allreduce(local, total, 2, MPI_DOUBLE,
+                      (this->m_errReduction == ErrorReduction::Max) ? MPI_MAX : MPI_SUM, m_comm);
+
+        int localActive = 0;
+        for (const int domIdx : m_localDomIds) {
+            localActive += active[domIdx];
+        }
+        int totalActive = 0;
+        MPI_Allreduce(&localActive, &totalActive, 1, MPI_INT, MPI_SUM, m_comm);
+
+        Errors totalErrs = {};
+        totalErrs.m_absolute = total[0];
+        totalErrs.m_relative = total[1];
+        this->finalize_errors(totalErrs, std::max(totalActive, 1));
+        this->m_ae = totalErrs.m_absolute;
+        this->m_re = totalErrs.m_relative;
+        return totalErrs;
+    }
+
+public:
+    MPI_Comm m_comm = MPI_COMM_NULL;
+    int m_rank = 0;
+    int m_nranks = 1;
+    std::vector<int> m_ownerVec;
+    std::vector<int> m_localDomIds;
+    std::vector<Message> m_sendVec;
+    std::vector<Message> m_recvVec;
+    std::vector<std::vector<int>> m_sendIdsVec;  // indices into m_sendVec, per sender
+    std::vector<MPI_Request> m_sendRequests;
+    std::vector<MPI_Request> m_recvRequests;
+    std::vector<int> m_completed;
+};
+
+}
+
+#endif
+#endif
@@ -54,9 +54,11 @@
 #include "pressio/rom_subspaces.hpp"
 #include "pressio/rom_lspg_unsteady.hpp"
 
+#include "./BS_thread_pool.hpp"
 #include "./tiling.hpp"
 #include "./custom_bcs.hpp"
 #include "./rom_utils.hpp"
+#include "./instrumentation.hpp"
 
 
 namespace pschwarz {
@@ -100,6 +102,67 @@ std::array<int, 3> calc_mesh_dims(const mesh_t & meshObj)
     return meshdims;
 }
 
+// Compact Schwarz iteration history. Of the states after each controller sub-step, only the
+//      checkpoint (start of the controller step, restored by every new Schwarz iteration) and the
+//      end of the previous Schwarz iteration (for convergence checks) are ever read.
+// The last slot aliases the live state or the checkpoint while they are unchanged,
+//      and is handed over by swap on reset, so a Schwarz iteration copies one state rather than count+1.
+template<class state_t>
+class StateHistory
+{
+    enum class Slot { Own, Live, Checkpoint };
+
+public:
+    void allocate(const state_t & zeroState, const int count) {
+        m_count = count;
+        m_checkpoint = zeroState;
+        m_last = zeroState;
+        m_lastSlot = Slot::Own;
+    }
+
+    void store(const int step, const state_t & live) {
+        if (step == 0) {
+            if (m_lastSlot == Slot::Checkpoint) { std::swap(m_last, m_checkpoint); }
+            m_lastSlot = (m_lastSlot == Slot::Live) ? Slot::Checkpoint : Slot::Own;
+            m_checkpoint = live;
+        }
+        else if (step == m_count) {
+            m_lastSlot = Slot::Live;
+        }
+        // intermediate sub-steps are never read back
+    }
+
+    // must be called before the live state is modified by anything other than restore()
+    void detach(const state_t & live) {
+        if (m_lastSlot == Slot::Live) {
+            m_last = live;
+            m_lastSlot = Slot::Own;
+        }
+    }
+
+    void restore(state_t & live) {
+        if (m_lastSlot == Slot::Live) {
+            std::swap(m_last, live);
+            m_lastSlot = Slot::Own;
+        }
+        live = m_checkpoint;
+    }
+
+    state_t & last(state_t & live) {
+        switch (m_lastSlot) {
+            case Slot::Live: return live;
+            case Slot::Checkpoint: return m_checkpoint;
+            default: return m_last;
+        }
+    }
+
+private:
+    int m_count = {};
+    state_t m_checkpoint;
+    state_t m_last;
+    Slot m_lastSlot = Slot::Own;
+};
+
 template<class mesh_type, class state_type>
 class SubdomainBase{
 public:
@@ -122,17 +185,51 @@ public:
     virtual void setNeighborGraph(graph_t &) = 0;
     virtual const graph_t & getNeighborGraph() const = 0;
     virtual int getDofPerCell() const = 0;
+    virtual bool isHyperReduced() const = 0;
+    virtual bool hasReducedState() const = 0;
+    virtual void setLazyFullState(bool) = 0;
     virtual void finalize_subdomain(std::string &) = 0;
     virtual state_t * getStateStencil() = 0;
     virtual state_t * getStateFull() = 0;
     virtual state_t * getStateReduced() = 0;
     virtual state_t * getStateBCs() = 0;
+    virtual state_t * getStateBCsBack() = 0;
+    virtual void swapStateBCs() = 0;
     virtual void setBCPointer(pda::impl::GhostRelativeLocation, state_t * ) = 0;
     virtual void setBCPointer(pda::impl::GhostRelativeLocation, graph_t *) = 0;
     virtual state_t & getLastStateInHistory() = 0;
+    virtual SolverStats getSolverStats() const = 0;
 };
 
 
+// BCs in demoapps order, 3D problems also take bottom and top
+template<class mesh_t, class prob_t>
+auto create_problem_with_bcs(
+    const mesh_t & mesh, prob_t probId,
+    pda::InviscidFluxReconstruction fluxOrder,
+    BCType bcLeft, BCType bcFront,
+    BCType bcRight, BCType bcBack,
+    BCType bcBottom, BCType bcTop,
+    const int icflag,
+    const std::unordered_map<std::string, typename mesh_t::scalar_type> & userParams)
+{
+    if constexpr (std::is_same_v<prob_t, pda::Euler3d>) {
+        return pda::create_problem_eigen(
+            mesh, probId, fluxOrder,
+            BCFunctor<mesh_t>(bcLeft),   BCFunctor<mesh_t>(bcFront),
+            BCFunctor<mesh_t>(bcRight),  BCFunctor<mesh_t>(bcBack),
+            BCFunctor<mesh_t>(bcBottom), BCFunctor<mesh_t>(bcTop),
+            icflag, userParams);
+    }
+    else {
+        return pda::create_problem_eigen(
+            mesh, probId, fluxOrder,
+            BCFunctor<mesh_t>(bcLeft),  BCFunctor<mesh_t>(bcFront),
+            BCFunctor<mesh_t>(bcRight), BCFunctor<mesh_t>(bcBack),
+            icflag, userParams);
+    }
+}
+
 template<class mesh_t, class app_type, class prob_t>
 class SubdomainFOM: public SubdomainBase<mesh_t, typename app_type::state_type>
 {
@@ -152,12 +249,13 @@ public:
         );
 
     using lin_solver_tag = pls::iterative::Bicgstab;
-    using linsolver_t    = pls::Solver<lin_solver_tag, jacob_t>;
+    using linsolver_t    = CountingLinearSolver<pls::Solver<lin_solver_tag, jacob_t>>;
     using nonlinsolver_t =
         decltype( pressio::nlsol::create_newton_solver( std::declval<stepper_t &>(),
                             std::declval<linsolver_t&>()) );
 
 public:
+    // bottom/top BCs come last, as they are only read for 3D problems
     SubdomainFOM(
         const int domainIndex,
         const mesh_t & mesh,
@@ -168,13 +266,14 @@ public:
         pda::InviscidFluxReconstruction fluxOrder,
         const int icflag,
         const std::string & icFileRoot,
-        const std::unordered_map<std::string, scalar_t> & userParams)
+        const std::unordered_map<std::string, scalar_t> & userParams,
+        BCType bcBottom = BCType::SchwarzDirichlet,
+        BCType bcTop = BCType::SchwarzDirichlet)
     : m_domIdx(domainIndex)
     , m_mesh(&mesh)
-    , m_app(std::make_shared<app_t>(pda::create_problem_eigen(
+    , m_app(std::make_shared<app_t>(create_problem_with_bcs(
             mesh, probId, fluxOrder,
-            BCFunctor<mesh_t>(bcLeft),  BCFunctor<mesh_t>(bcFront),
-            BCFunctor<mesh_t>(bcRight), BCFunctor<mesh_t>(bcBack),
+            bcLeft, bcFront, bcRight, bcBack, bcBottom, bcTop,
             icflag, userParams)))
     , m_state(m_app->initialCondition())
     , m_stepper(pressio::ode::create_implicit_stepper(odeScheme, *(m_app)))
@@ -205,7 +304,7 @@ public:
         m_nonlinSolver.setStopTolerance(1e-5);
     }
 
-    state_t & getLastStateInHistory() final { return m_stateHistVec.back(); }
+    state_t & getLastStateInHistory() final { return m_stateHist.last(m_state); }
 
     void setBCPointer(pda::impl::GhostRelativeLocation grl, state_t * v) final {
         m_app->setBCPointer(grl, v);
@@ -215,6 +314,9 @@ public:
     }
 
     state_t * getStateBCs() final { return &m_stateBCs; }
+    state_t * getStateBCsBack() final { return &m_stateBCsBack; }
+    // O(1) exchange of the buffer contents, BC functors keep pointing at m_stateBCs
+    void swapStateBCs() final { m_stateBCs.swap(m_stateBCsBack); }
     state_t * getStateStencil() final { return &m_state; }
     state_t * getStateFull() final { return &m_state; }
     state_t * getStateReduced() final {
@@ -222,6 +324,10 @@ public:
     }
 
     int getDofPerCell() const final { return m_app->numDofPerCell(); }
+    bool isHyperReduced() const final { return false; }
+    bool hasReducedState() const final { return false; }
+    // full state is the solution state, nothing to release
+    void setLazyFullState(bool) final {}
     const mesh_t & getMeshStencil() const final { return *m_mesh; }
     const mesh_t & getMeshFull() const final { return *m_mesh; }
     const std::array<int, 3> getFullMeshDims() const final { return m_fullMeshDims; }
@@ -256,6 +362,8 @@ public:
         const int numDofStencilBc = m_app->numDofPerCell() * numGhostCells;
         pda::resize(m_stateBCs, numDofStencilBc);
         m_stateBCs.fill(0.0);
+        pda::resize(m_stateBCsBack, numDofStencilBc);
+        m_stateBCsBack.fill(0.0);
     }
 
     void finalize_subdomain(std::string &) final {
@@ -263,25 +371,28 @@ public:
     }
 
     void allocateStorageForHistory(const int count) final {
-        for (int histIdx = 0; histIdx < count + 1; ++histIdx) {
-            // createState creates a new state with all elements equal to zero
-            m_stateHistVec.emplace_back(m_app->createState());
-        }
+        // createState creates a new state with all elements equal to zero
+        m_stateHist.allocate(m_app->createState(), count);
     }
 
     void doStep(pode::StepStartAt<double> startTime,
         pode::StepCount step,
         pode::StepSize<double> dt) final
     {
+        m_stateHist.detach(m_state);
         m_stepper(m_state, startTime, step, dt, m_nonlinSolver);
     }
 
+    SolverStats getSolverStats() const final {
+        return m_linSolverObj->stats();
+    }
+
     void storeStateHistory(const int step) final {
-        m_stateHistVec[step] = m_state;
+        m_stateHist.store(step, m_state);
     }
 
     void resetStateFromHistory() final {
-        m_state = m_stateHistVec[0];
+        m_stateHist.restore(m_state);
     }
 
     void updateFullState() final {
@@ -297,7 +408,8 @@ public:
     std::shared_ptr<app_t> m_app;
     state_t m_state;
     state_t m_stateBCs;
-    std::vector<state_t> m_stateHistVec;
+    state_t m_stateBCsBack;  // written by neighbors in double-buffered exchange
+    StateHistory<state_t> m_stateHist;
 
     stepper_t m_stepper;
     std::shared_ptr<linsolver_t> m_linSolverObj;
@@ -338,21 +450,27 @@ public:
         const std::unordered_map<std::string, typename mesh_t::scalar_type> & userParams,
         const std::string & transRoot,
         const std::string & basisRoot,
-        int nmodes)
+        int nmodes,
+        BCType bcBottom = BCType::SchwarzDirichlet,
+        BCType bcTop = BCType::SchwarzDirichlet)
     : m_domIdx(domainIndex)
     , m_mesh(&mesh)
-    , m_app(std::make_shared<app_t>(pda::create_problem_eigen(
+    , m_app(std::make_shared<app_t>(create_problem_with_bcs(
             mesh, probId, fluxOrder,
-            BCFunctor<mesh_t>(bcLeft),  BCFunctor<mesh_t>(bcFront),
-            BCFunctor<mesh_t>(bcRight), BCFunctor<mesh_t>(bcBack),
+            bcLeft, bcFront, bcRight, bcBack, bcBottom, bcTop,
             icflag, userParams)))
     , m_state(m_app->initialCondition())
     , m_nmodes(nmodes)
-    , m_trans(read_vector_from_binary<scalar_t>(transRoot + "_" + std::to_string(domainIndex) + ".bin"))
-    , m_basis(read_matrix_from_binary<scalar_t>(basisRoot + "_" + std::to_string(domainIndex) + ".bin", nmodes))
-    , m_trialSpace(prom::create_trial_column_subspace<state_t>(std::move(m_basis), std::move(m_trans), true))
+    , m_transMap(map_binary_file<scalar_t>(transRoot + "_" + std::to_string(domainIndex) + ".bin"))
+    , m_basisMap(map_binary_file<scalar_t>(basisRoot + "_" + std::to_string(domainIndex) + ".bin"))
+    , m_trialSpace(prom::create_trial_column_subspace<state_t>(
+        basis_t(m_basisMap->matrix(nmodes)), trans_t(m_transMap->vector()), true))
     , m_stateReduced(m_trialSpace.createReducedState())
     {
+        // the trial space owns a copy of the basis, unmap the files so their pages leave resident memory
+        m_transMap.reset();
+        m_basisMap.reset();
+
         m_fullMeshDims = calc_mesh_dims(*m_mesh);
 
         pda::resize(m_sampleGids, m_mesh->sampleMeshSize());
@@ -389,7 +507,7 @@ public:
 
     }
 
-    state_t & getLastStateInHistory() final { return m_stateHistVec.back(); }
+    state_t & getLastStateInHistory() final { return m_stateHist.last(m_state); }
     void setBCPointer(pda::impl::GhostRelativeLocation grl, state_t * v) final{
         m_app->setBCPointer(grl, v);
     }
@@ -398,11 +516,18 @@ public:
     }
 
     state_t * getStateBCs() final { return &m_stateBCs; }
+    state_t * getStateBCsBack() final { return &m_stateBCsBack; }
+    // O(1) exchange of the buffer contents, BC functors keep pointing at m_stateBCs
+    void swapStateBCs() final { m_stateBCs.swap(m_stateBCsBack); }
     state_t * getStateStencil() final { return &m_state; }
     state_t * getStateFull() final { return &m_state; }
     state_t * getStateReduced() final { return &m_stateReduced; }
 
     int getDofPerCell() const final { return m_app->numDofPerCell(); }
+    bool isHyperReduced() const final { return false; }
+    bool hasReducedState() const final { return true; }
+    // full state is the solution state, nothing to release
+    void setLazyFullState(bool) final {}
     const mesh_t & getMeshStencil() const final { return *m_mesh; }
     const mesh_t & getMeshFull() const final { return *m_mesh; }
     const std::array<int, 3> getFullMeshDims() const final { return m_fullMeshDims; }
@@ -437,6 +562,8 @@ public:
         const int numDofStencilBc = m_app->numDofPerCell() * numGhostCells;
         pda::resize(m_stateBCs, numDofStencilBc);
         m_stateBCs.fill(0.0);
+        pda::resize(m_stateBCsBack, numDofStencilBc);
+        m_stateBCsBack.fill(0.0);
     }
 
     void finalize_subdomain(std::string &) final {
@@ -444,23 +571,23 @@ public:
     }
 
     void allocateStorageForHistory(const int count){
-        for (int histIdx = 0; histIdx < count + 1; ++histIdx) {
-            m_stateHistVec.emplace_back(m_app->createState());
-            m_stateReducedHistVec.emplace_back(m_trialSpace.createReducedState());
-        }
+        m_stateHist.allocate(m_app->createState(), count);
+        m_stateReducedCheckpoint = m_trialSpace.createReducedState();
     }
 
+    // only the checkpoint of the latent state is ever restored
     void storeStateHistory(const int step) final {
-        m_stateHistVec[step] = m_state;
-        m_stateReducedHistVec[step] = m_stateReduced;
+        m_stateHist.store(step, m_state);
+        if (step == 0) { m_stateReducedCheckpoint = m_stateReduced; }
     }
 
     void resetStateFromHistory() final {
-        m_state = m_stateHistVec[0];
-        m_stateReduced = m_stateReducedHistVec[0];
+        m_stateHist.restore(m_state);
+        m_stateReduced = m_stateReducedCheckpoint;
     }
 
     void updateFullState() final {
+        m_stateHist.detach(m_state);
         m_trialSpace.mapFromReducedState(m_stateReduced, m_state);
     }
 
@@ -473,14 +600,15 @@ protected:
     std::shared_ptr<app_t> m_app;
     state_t m_state;
     state_t m_stateBCs;
-    std::vector<state_t> m_stateHistVec;
+    state_t m_stateBCsBack;  // written by neighbors in double-buffered exchange
+    StateHistory<state_t> m_stateHist;
 
     int m_nmodes;
-    trans_t m_trans;
-    basis_t m_basis;
+    std::shared_ptr<const MappedBinaryMatrix<scalar_t>> m_transMap;
+    std::shared_ptr<const MappedBinaryMatrix<scalar_t>> m_basisMap;
     trial_t m_trialSpace;
     state_t m_stateReduced;
-    std::vector<state_t> m_stateReducedHistVec;
+    state_t m_stateReducedCheckpoint;
 
 };
 
@@ -501,7 +629,7 @@ public:
 
     using hessian_t   = Eigen::Matrix<scalar_t, -1, -1>; // TODO: generalize?
     using solver_tag  = pls::direct::HouseholderQR;
-    using linsolver_t = pls::Solver<solver_tag, hessian_t>;
+    using linsolver_t = CountingLinearSolver<pls::Solver<solver_tag, hessian_t>>;
 
     using problem_t       = decltype(plspg::create_unsteady_problem(pressio::ode::StepScheme(), std::declval<trial_t&>(), std::declval<app_t&>()));
     using nonlinsolver_t  = decltype(pressio::nlsol::create_gauss_newton_solver(std::declval<problem_t&>(), std::declval<linsolver_t&>()));
@@ -521,11 +649,14 @@ public:
         const std::unordered_map<std::string, typename mesh_t::scalar_type> & userParams,
         const std::string & transRoot,
         const std::string & basisRoot,
-        const int nmodes)
+        const int nmodes,
+        BCType bcBottom = BCType::SchwarzDirichlet,
+        BCType bcTop = BCType::SchwarzDirichlet)
     : base_t(domainIndex, mesh,
              bcLeft, bcFront, bcRight, bcBack,
              probId, odeScheme, fluxOrder, icflag, icFileRoot, userParams,
-             transRoot, basisRoot, nmodes)
+             transRoot, basisRoot, nmodes,
+             bcBottom, bcTop)
     , m_problem(plspg::create_unsteady_problem(odeScheme, this->m_trialSpace, *(this->m_app)))
     , m_linSolverObj(std::make_shared<linsolver_t>())
     , m_nonlinSolver(pressio::nlsol::create_gauss_newton_solver(m_problem, *m_linSolverObj))
@@ -540,6 +671,10 @@ public:
         m_problem(this->m_stateReduced, startTime, step, dt, m_nonlinSolver);
     }
 
+    SolverStats getSolverStats() const final {
+        return m_linSolverObj->stats();
+    }
+
 private:
     problem_t m_problem;
     std::shared_ptr<linsolver_t> m_linSolverObj;
@@ -588,33 +723,33 @@ public:
         const std::string & transRoot,
         const std::string & basisRoot,
         const int nmodes,
-        const std::string & sampleFile)
+        const std::string & sampleFile,
+        BCType bcBottom = BCType::SchwarzDirichlet,
+        BCType bcTop = BCType::SchwarzDirichlet)
     : m_domIdx(domainIndex)
     , m_meshFull(&meshFull)
     , m_probId(probId)
     , m_fluxOrder(fluxOrder)
     , m_bcLeft(bcLeft), m_bcFront(bcFront)
     , m_bcRight(bcRight), m_bcBack(bcBack)
+    , m_bcBottom(bcBottom), m_bcTop(bcTop)
     , m_icflag(icflag)
     , m_userParams(userParams)
-    , m_appFull(std::make_shared<app_t>(pda::create_problem_eigen(
+    , m_appFull(std::make_shared<app_t>(create_problem_with_bcs(
             meshFull, probId, fluxOrder,
-            BCFunctor<mesh_t>(bcLeft),  BCFunctor<mesh_t>(bcFront),
-            BCFunctor<mesh_t>(bcRight), BCFunctor<mesh_t>(bcBack),
+            bcLeft, bcFront, bcRight, bcBack, bcBottom, bcTop,
             icflag, userParams)))
     , m_sampleFile(sampleFile)
     , m_sampleGids(create_cell_gids_vector_and_fill_from_ascii(m_sampleFile))
     , m_nmodes(nmodes)
-    , m_transFull(read_vector_from_binary<scalar_t>(transRoot + "_" + std::to_string(domainIndex) + ".bin"))
-    , m_basisFull(read_matrix_from_binary<scalar_t>(basisRoot + "_" + std::to_string(domainIndex) + ".bin", nmodes))
-    , m_transRead(read_vector_from_binary<scalar_t>(transRoot + "_" + std::to_string(domainIndex) + ".bin"))
-    , m_basisRead(read_matrix_from_binary<scalar_t>(basisRoot + "_" + std::to_string(domainIndex) + ".bin", nmodes))
-    , m_trialSpaceFull(prom::create_trial_column_subspace<
-       state_t>(std::move(m_basisFull), std::move(m_transFull), true))
+    , m_transFile(transRoot + "_" + std::to_string(domainIndex) + ".bin")
+    , m_basisFile(basisRoot + "_" + std::to_string(domainIndex) + ".bin")
+    , m_trialSpaceFull(std::make_shared<trial_t>(prom::create_trial_column_subspace<
+       state_t>(basis_t(basisMap().matrix(nmodes)), trans_t(transMap().vector()), true)))
     {
 
         m_stateFull = m_appFull->initialCondition();
-        m_stateReduced = m_trialSpaceFull.createReducedState();
+        m_stateReduced = m_trialSpaceFull->createReducedState();
 
         m_fullMeshDims = calc_mesh_dims(*m_meshFull);
 
@@ -622,8 +757,8 @@ public:
         if (icFileRoot.empty()) {
             // project full state initial conditions
             auto u = pressio::ops::clone(m_stateFull);
-            pressio::ops::update(u, 0., m_stateFull, 1, m_trialSpaceFull.translationVector(), -1);
-            pressio::ops::product(::pressio::transpose(), 1., m_trialSpaceFull.basis(), u, 0., m_stateReduced);
+            pressio::ops::update(u, 0., m_stateFull, 1, m_trialSpaceFull->translationVector(), -1);
+            pressio::ops::product(::pressio::transpose(), 1., m_trialSpaceFull->basis(), u, 0., m_stateReduced);
         }
         else {
             // load from file
@@ -636,18 +771,18 @@ public:
             else if (nrows == m_stateFull.rows()) {
                 // project full state initial conditions
                 auto u = pressio::ops::clone(instate);
-                pressio::ops::update(u, 0., instate, 1, m_trialSpaceFull.translationVector(), -1);
-                pressio::ops::product(::pressio::transpose(), 1., m_trialSpaceFull.basis(), u, 0., m_stateReduced);
+                pressio::ops::update(u, 0., instate, 1, m_trialSpaceFull->translationVector(), -1);
+                pressio::ops::product(::pressio::transpose(), 1., m_trialSpaceFull->basis(), u, 0., m_stateReduced);
             }
             else {
                 throw std::runtime_error("Invalid icFile dimensions: " + std::to_string(nrows));
             }
         }
-        m_trialSpaceFull.mapFromReducedState(m_stateReduced, m_stateFull);
+        m_trialSpaceFull->mapFromReducedState(m_stateReduced, m_stateFull);
 
     }
 
-    state_t & getLastStateInHistory() final { return m_stateHistVec.back(); }
+    state_t & getLastStateInHistory() final { return m_stateHist.last(m_stateStencil); }
     void setBCPointer(pda::impl::GhostRelativeLocation grl, state_t * v) final{
         m_appHyper->setBCPointer(grl, v);
     }
@@ -656,14 +791,42 @@ public:
     }
 
     state_t * getStateBCs() final { return &m_stateBCs; }
+    state_t * getStateBCsBack() final { return &m_stateBCsBack; }
+    // O(1) exchange of the buffer contents, BC functors keep pointing at m_stateBCs
+    void swapStateBCs() final { m_stateBCs.swap(m_stateBCsBack); }
     state_t * getStateStencil() final { return &m_stateStencil; }
     state_t * getStateFull() final {
-        m_trialSpaceFull.mapFromReducedState(m_stateReduced, m_stateFull);
+        if (m_trialSpaceFull) {
+            m_trialSpaceFull->mapFromReducedState(m_stateReduced, m_stateFull);
+        }
+        else {
+            // lazy mode, rebuilt from the basis file mapping on request only
+            m_stateFull = transMap().vector() + basisMap().matrix(m_nmodes) * m_stateReduced;
+        }
         return &m_stateFull;
     }
     state_t * getStateReduced() final { return &m_stateReduced; }
 
     int getDofPerCell() const final { return m_appHyper->numDofPerCell(); }
+    bool isHyperReduced() const final { return true; }
+    bool hasReducedState() const final { return true; }
+
+    // In lazy mode the full-mesh trial space is dropped, and the full-mesh state is only
+    //      reconstructed when getStateFull() is called (e.g. on observer output steps).
+    //      Resident memory then scales with the stencil mesh rather than the full mesh.
+    void setLazyFullState(bool lazy) final {
+        m_lazyFullState = lazy;
+        if (lazy) {
+            m_trialSpaceFull.reset();
+            // the full state is still needed to initialize the stencil state in finalize_subdomain()
+            if (m_trialSpaceHyper) { m_stateFull = state_t(); }
+        }
+        else if (!m_trialSpaceFull) {
+            m_trialSpaceFull = std::make_shared<trial_t>(prom::create_trial_column_subspace<
+                state_t>(basis_t(basisMap().matrix(m_nmodes)), trans_t(transMap().vector()), true));
+            if (m_trialSpaceHyper) { releaseMaps(); }
+        }
+    }
     const mesh_t & getMeshStencil() const final {
         if (!m_hyperMeshSet) {
             throw std::runtime_error("Must call genHyperMesh() before getMeshStencil()");
@@ -721,6 +884,8 @@ public:
         const int numDofStencilBc = m_appHyper->numDofPerCell() * numGhostCells;
         pda::resize(m_stateBCs, numDofStencilBc);
         m_stateBCs.fill(0.0);
+        pda::resize(m_stateBCsBack, numDofStencilBc);
+        m_stateBCsBack.fill(0.0);
     }
 
     // All this junk has to happen AFTER construction,
@@ -734,21 +899,24 @@ public:
             throw std::runtime_error("Must call setStencilGids() before finalize_subdomain()");
         }
 
-        m_appHyper = std::make_shared<app_t>(pda::create_problem_eigen(
+        m_appHyper = std::make_shared<app_t>(create_problem_with_bcs(
             m_meshHyper, m_probId, m_fluxOrder,
-            BCFunctor<mesh_t>(m_bcLeft),  BCFunctor<mesh_t>(m_bcFront),
-            BCFunctor<mesh_t>(m_bcRight), BCFunctor<mesh_t>(m_bcBack),
+            m_bcLeft, m_bcFront, m_bcRight, m_bcBack, m_bcBottom, m_bcTop,
             m_icflag, m_userParams));
 
-        auto m_transHyper = reduce_vector_on_stencil_mesh(m_transRead, m_stencilGids, m_appFull->numDofPerCell());
-        auto m_basisHyper = reduce_matrix_on_stencil_mesh(m_basisRead, m_stencilGids, m_appFull->numDofPerCell());
+        // sliced straight from the shared file mappings, only stencil rows are copied
+        auto m_transHyper = reduce_vector_on_stencil_mesh(transMap().vector(), m_stencilGids, m_appFull->numDofPerCell());
+        auto m_basisHyper = reduce_matrix_on_stencil_mesh(basisMap().matrix(m_nmodes), m_stencilGids, m_appFull->numDofPerCell());
         m_trialSpaceHyper = std::make_shared<trialHyp_t>(prom::create_trial_column_subspace<
                                                          state_t>(std::move(m_basisHyper),
                                                          std::move(m_transHyper),
                                                          true));
+        // outside of lazy mode the full trial space holds its own copy, so the mappings can go
+        if (!m_lazyFullState) { releaseMaps(); }
 
         // initialize stencil mesh state
         m_stateStencil = reduce_vector_on_stencil_mesh(m_stateFull, m_stencilGids, m_appFull->numDofPerCell());
+        if (m_lazyFullState) { m_stateFull = state_t(); }
 
         updateFullState();
         init_bc_state();
@@ -756,26 +924,41 @@ public:
     }
 
     void allocateStorageForHistory(const int count){
-        for (int histIdx = 0; histIdx < count + 1; ++histIdx) {
-            m_stateHistVec.emplace_back(m_appHyper->createState());
-            m_stateReducedHistVec.emplace_back(m_trialSpaceHyper->createReducedState());
-        }
+        m_stateHist.allocate(m_appHyper->createState(), count);
+        m_stateReducedCheckpoint = m_trialSpaceHyper->createReducedState();
     }
 
+    // only the checkpoint of the latent state is ever restored
     void storeStateHistory(const int step) final {
-        m_stateHistVec[step] = m_stateStencil;
-        m_stateReducedHistVec[step] = m_stateReduced;
+        m_stateHist.store(step, m_stateStencil);
+        if (step == 0) { m_stateReducedCheckpoint = m_stateReduced; }
     }
 
     void resetStateFromHistory() final {
-        m_stateStencil = m_stateHistVec[0];
-        m_stateReduced = m_stateReducedHistVec[0];
+        m_stateHist.restore(m_stateStencil);
+        m_stateReduced = m_stateReducedCheckpoint;
     }
 
     void updateFullState() final {
+        m_stateHist.detach(m_stateStencil);
         m_trialSpaceHyper->mapFromReducedState(m_stateReduced, m_stateStencil);
     }
 
+private:
+    // the basis files are (re)mapped on demand, and unmapped again once a trial space owns a copy
+    const MappedBinaryMatrix<scalar_t> & transMap() {
+        if (!m_transMap) { m_transMap = map_binary_file<scalar_t>(m_transFile); }
+        return *m_transMap;
+    }
+    const MappedBinaryMatrix<scalar_t> & basisMap() {
+        if (!m_basisMap) { m_basisMap = map_binary_file<scalar_t>(m_basisFile); }
+        return *m_basisMap;
+    }
+    void releaseMaps() {
+        m_transMap.reset();
+        m_basisMap.reset();
+    }
+
 public:
     int m_domIdx;
     mesh_t const * m_meshFull;
@@ -793,13 +976,16 @@ public:
     BCType m_bcFront;
     BCType m_bcRight;
     BCType m_bcBack;
+    BCType m_bcBottom;
+    BCType m_bcTop;
 
     state_t m_stateStencil;  // on stencil mesh
     state_t m_stateFull;     // on full, unsampled mesh (required for projection)
     state_t m_stateReduced;  // latent state
     state_t m_stateBCs;
-    std::vector<state_t> m_stateHistVec;
-    std::vector<state_t> m_stateReducedHistVec;
+    state_t m_stateBCsBack;  // written by neighbors in double-buffered exchange
+    StateHistory<state_t> m_stateHist;
+    state_t m_stateReducedCheckpoint;
 
     // for error checking
     bool m_hyperMeshSet = false;
@@ -810,11 +996,12 @@ public:
     stencil_t m_stencilGids;
 
     int m_nmodes;
-    trans_t m_transFull;
-    basis_t m_basisFull;
-    trans_t m_transRead;
-    basis_t m_basisRead;
-    trial_t m_trialSpaceFull;
+    std::string m_transFile;
+    std::string m_basisFile;
+    std::shared_ptr<const MappedBinaryMatrix<scalar_t>> m_transMap;  // only held while needed
+    std::shared_ptr<const MappedBinaryMatrix<scalar_t>> m_basisMap;
+    std::shared_ptr<trial_t> m_trialSpaceFull;  // null in lazy mode
+    bool m_lazyFullState = false;
 
     std::shared_ptr<trialHyp_t> m_trialSpaceHyper;
 
@@ -834,7 +1021,7 @@ public:
 
     using hessian_t   = Eigen::Matrix<scalar_t, -1, -1>; // TODO: generalize?
     using solver_tag  = pls::direct::HouseholderQR;
-    using linsolver_t = pls::Solver<solver_tag, hessian_t>;
+    using linsolver_t = CountingLinearSolver<pls::Solver<solver_tag, hessian_t>>;
 
     using trialHyp_t = typename base_t::trialHyp_t;
 
@@ -873,12 +1060,15 @@ public:
         const std::string & sampleFile,
         const std::string & weigher_type,
         const std::string & basisRoot_gpod,
-        const int nmodes_gpod)
+        const int nmodes_gpod,
+        BCType bcBottom = BCType::SchwarzDirichlet,
+        BCType bcTop = BCType::SchwarzDirichlet)
     : base_t(domainIndex, meshFull,
              bcLeft, bcFront, bcRight, bcBack,
              probId, odeScheme, fluxOrder, icflag, icFileRoot, userParams,
              transRoot, basisRoot, nmodes,
-             sampleFile)
+             sampleFile,
+             bcBottom, bcTop)
     {
         m_odeScheme = odeScheme;
         m_weigher_type = weigher_type;
@@ -890,19 +1080,21 @@ public:
         (*m_problemHyper)(this->m_stateReduced, startTime, step, dt, *m_nonlinSolverHyper);
     }
 
+    SolverStats getSolverStats() const final {
+        // solver is only created in finalize_subdomain()
+        return m_linSolverObjHyper ? m_linSolverObjHyper->stats() : SolverStats{};
+    }
+
     // Again, this has to be done because the hyper-reduced mesh
     //      has not been initialized on construction
-    // tempdir is the temporary directory that stores the true stencil mesh
     void finalize_subdomain(std::string & tempdir) final
     {
         SubdomainHyper<mesh_t, app_t, prob_t>::finalize_subdomain(tempdir);
 
-        std::string stencilFile = tempdir + "/domain_" + std::to_string(this->m_domIdx) + "/stencil_mesh_gids.dat";
-
         m_updaterHyper = std::make_shared<updaterHyp_t>
             (create_hyper_updater<mesh_t>(this->getDofPerCell(),
-                                          stencilFile,
-                                          this->m_sampleFile));
+                                          this->m_stencilGids,
+                                          this->m_sampleGids));
 
         m_problemHyper = std::make_shared<problemHyp_t>
             (plspg::create_unsteady_problem(m_odeScheme,
@@ -947,6 +1139,96 @@ public:
     std::shared_ptr<nonlinsolverHyp_t> m_nonlinSolverHyper;
 };
 
+//
+// Stand-in for a subdomain solved by another process. Only carries the meshes, sample cells
+//      and neighbor graph that the interface connectivity is computed from, there is no
+//      problem instance, basis or state, and solver calls throw.
+//
+template<class mesh_t, class state_type>
+class SubdomainInterface: public SubdomainBase<mesh_t, state_type>
+{
+    using base_t = SubdomainBase<mesh_t, state_type>;
+
+public:
+    using graph_t = typename mesh_t::graph_t;
+    using state_t = state_type;
+    using stencil_t = typename base_t::stencil_t;
+
+    // an empty sampleFile samples every cell of the full mesh
+    SubdomainInterface(const int domainIndex, const mesh_t & meshFull, const std::string & sampleFile)
+    : m_domIdx(domainIndex)
+    , m_meshFull(&meshFull)
+    , m_isHyper(!sampleFile.empty())
+    {
+        m_fullMeshDims = calc_mesh_dims(*m_meshFull);
+        if (m_isHyper) {
+            m_sampleGids = create_cell_gids_vector_and_fill_from_ascii(sampleFile);
+        }
+        else {
+            pda::resize(m_sampleGids, m_meshFull->sampleMeshSize());
+            for (int i = 0; i < m_meshFull->sampleMeshSize(); ++i) {
+                m_sampleGids(i) = i;
+            }
+        }
+    }
+
+    const mesh_t & getMeshStencil() const final {
+        if (!m_isHyper) {
+            return *m_meshFull;
+        }
+        if (!m_hyperMeshSet) {
+            throw std::runtime_error("Must call genHyperMesh() before getMeshStencil()");
+        }
+        return m_meshHyper;
+    }
+    const mesh_t & getMeshFull() const final { return *m_meshFull; }
+    const std::array<int, 3> getFullMeshDims() const final { return m_fullMeshDims; }
+    const stencil_t * getSampleGids() const final { return &m_sampleGids; }
+    void setStencilGids(std::vector<int>) final { /*noop*/ }
+    void genHyperMesh(std::string & subdom_dir) final {
+        m_hyperMeshSet = true;
+        m_meshHyper = pda::load_cellcentered_uniform_mesh_eigen(subdom_dir);
+    }
+    const graph_t & getNeighborGraph() const final { return m_neighborGraph; }
+    void setNeighborGraph(graph_t & graph_in) final { m_neighborGraph = graph_in; }
+    bool isHyperReduced() const final { return m_isHyper; }
+    bool hasReducedState() const final { return false; }
+    void setLazyFullState(bool) final { /*noop*/ }
+
+    int getDofPerCell() const final { throw notOwned("getDofPerCell"); }
+    void finalize_subdomain(std::string &) final { throw notOwned("finalize_subdomain"); }
+    void allocateStorageForHistory(const int) final { throw notOwned("allocateStorageForHistory"); }
+    void doStep(pode::StepStartAt<double>, pode::StepCount, pode::StepSize<double>) final { throw notOwned("doStep"); }
+    void storeStateHistory(const int) final { throw notOwned("storeStateHistory"); }
+    void resetStateFromHistory() final { throw notOwned("resetStateFromHistory"); }
+    void updateFullState() final { throw notOwned("updateFullState"); }
+    state_t * getStateStencil() final { throw notOwned("getStateStencil"); }
+    state_t * getStateFull() final { throw notOwned("getStateFull"); }
+    state_t * getStateReduced() final { throw notOwned("getStateReduced"); }
+    state_t * getStateBCs() final { throw notOwned("getStateBCs"); }
+    state_t * getStateBCsBack() final { throw notOwned("getStateBCsBack"); }
+    void swapStateBCs() final { throw notOwned("swapStateBCs"); }
+    void setBCPointer(pda::impl::GhostRelativeLocation, state_t *) final { throw notOwned("setBCPointer"); }
+    void setBCPointer(pda::impl::GhostRelativeLocation, graph_t *) final { throw notOwned("setBCPointer"); }
+    state_t & getLastStateInHistory() final { throw notOwned("getLastStateInHistory"); }
+    SolverStats getSolverStats() const final { throw notOwned("getSolverStats"); }
+
+private:
+    std::runtime_error notOwned(const std::string & method) const {
+        return std::runtime_error("Called " + method + "() on subdomain " + std::to_string(m_domIdx)
+                                  + ", which is owned by another process");
+    }
+
+    int m_domIdx;
+    mesh_t const * m_meshFull;
+    bool m_isHyper;
+    bool m_hyperMeshSet = false;
+    mesh_t m_meshHyper;
+    std::array<int, 3> m_fullMeshDims;
+    stencil_t m_sampleGids;
+    graph_t m_neighborGraph;
+};
+
 //
 // auxiliary function to create a vector of meshes given a count and meshRoot
 //
@@ -967,41 +1249,37 @@ auto create_meshes(std::string const & meshRoot, const int n)
 }
 
 //
-// all domains are assumed to be FOM domains
+// same as above, meshes are read concurrently on the thread pool
 //
-template<class app_t, class mesh_t, class prob_t>
-auto create_subdomains(
-    const std::vector<mesh_t> & meshes,
-    const Tiling & tiling,
-    prob_t probId,
-    std::vector<pode::StepScheme> & odeSchemes,
-    std::vector<pda::InviscidFluxReconstruction> & fluxOrders,
-    int icFlag = 0,
-    const std::unordered_map<std::string, typename app_t::scalar_type> & userParams = {})
+auto create_meshes(BS::thread_pool & pool, std::string const & meshRoot, const int n)
 {
-    auto ndomains = tiling.count();
-    std::vector<std::string> domFlagVec(ndomains, "FOM");
+    using mesh_t = pda::cellcentered_uniform_mesh_eigen_type;
 
-    // dummy arguments
-    std::vector<int> nmodesVec(ndomains, -1);
-    std::vector<std::string> samplePaths(ndomains, "");
-    std::vector<int> nmodesVec_gpod(ndomains, -1);
+    std::vector<mesh_t> meshes(n);
+    std::vector<std::string> meshPaths;
+    for (int domIdx = 0; domIdx < n; ++domIdx) {
+        meshPaths.emplace_back(meshRoot + "/domain_" + std::to_string(domIdx));
+    }
 
-    return create_subdomains<app_t>(
-        meshes, tiling,
-        probId, odeSchemes, fluxOrders,
-        domFlagVec, "", "", nmodesVec,
-        icFlag, "", samplePaths,
-        "identity", "", nmodesVec_gpod,
-        userParams);
+    // futures, so that a failed read is rethrown here instead of terminating the process
+    auto futures = pool.submit_loop<int>(0, n, [&](const int domIdx) {
+        meshes[domIdx] = pda::load_cellcentered_uniform_mesh_eigen(meshPaths[domIdx]);
+    });
+    futures.wait();
+    futures.get();
 
+    return std::tuple(meshes, meshPaths);
 }
 
 //
 // Subdomain type specified by domFlagVec
+// subdomains are constructed concurrently if a thread pool is given, the result order is unaffected
+// if ownedVec is given, subdomains not owned by this process are SubdomainInterface stand-ins
 //
 template<class app_t, class mesh_t, class prob_t>
-auto create_subdomains(
+auto create_subdomains_impl(
+    BS::thread_pool * pool,
+    const std::vector<char> * ownedVec,
     const std::vector<mesh_t> & meshes,
     const Tiling & tiling,
     prob_t probId,
@@ -1011,17 +1289,17 @@ auto create_subdomains(
     const std::string & transRoot,
     const std::string & basisRoot,
     const std::vector<int> & nmodesVec,
-    int icFlag = 0,
-    const std::string & icFileRoot = "",
-    const std::vector<std::string> & samplePaths = {},
-    const std::string & weigher_type = "identity",
-    const std::string & basisRoot_gpod = "",
-    const std::vector<int> & nmodesVec_gpod = {},
-    const std::unordered_map<std::string, typename app_t::scalar_type> & userParams = {})
+    int icFlag,
+    const std::string & icFileRoot,
+    const std::vector<std::string> & samplePaths,
+    const std::string & weigher_type,
+    const std::string & basisRoot_gpod,
+    const std::vector<int> & nmodesVec_gpod,
+    const std::unordered_map<std::string, typename app_t::scalar_type> & userParams)
 {
 
     using subdomain_t = SubdomainBase<mesh_t, typename app_t::state_type>;
-    std::vector<std::shared_ptr<subdomain_t>> result;
+    std::vector<std::shared_ptr<subdomain_t>> result(tiling.count());
 
     const int ndomX = tiling.countX();
     const int ndomY = tiling.countY();
@@ -1037,6 +1315,12 @@ auto create_subdomains(
     if (!samplePaths.empty()) {
         if (samplePaths.size() != ndomains) { throw std::runtime_error("Incorrect number of sample mesh paths"); }
     }
+    if (ownedVec && (ownedVec->size() != ndomains)) { throw std::runtime_error("Incorrect number of ownership flags"); }
+    for (const auto & domFlag : domFlagVec) {
+        if ((domFlag != "FOM") && (domFlag != "LSPG") && (domFlag != "LSPGHyper")) {
+            throw std::runtime_error("Invalid subdomain flag value: " + domFlag);
+        }
+    }
 
     // Gappy POD modes are a bit finicky
     // TODO: generalize to finding substring "Hyper" if Galerkin implemented
@@ -1054,8 +1338,15 @@ auto create_subdomains(
     }
 
     // determine boundary conditions for each subdomain, specify app type
-    for (int domIdx = 0; domIdx < ndomains; ++domIdx)
+    auto create_subdomain = [&](const int domIdx)
     {
+        if (ownedVec && !(*ownedVec)[domIdx]) {
+            const bool isHyper = (domFlagVec[domIdx] == "LSPGHyper");
+            result[domIdx] = std::make_shared<SubdomainInterface<mesh_t, typename app_t::state_type>>(
+                domIdx, meshes[domIdx], isHyper ? samplePaths[domIdx] : std::string());
+            return;
+        }
+
 
         // the actual BC used are defaulted to Dirichlet, and modified below
         // when they need to be physical BCs
@@ -1063,9 +1354,12 @@ auto create_subdomains(
         BCType bcRight = BCType::SchwarzDirichlet;
         BCType bcFront = BCType::SchwarzDirichlet;
         BCType bcBack  = BCType::SchwarzDirichlet;
+        BCType bcBottom = BCType::SchwarzDirichlet;
+        BCType bcTop    = BCType::SchwarzDirichlet;
 
         const int i = domIdx % ndomX;
-        const int j = domIdx / ndomX;
+        const int j = (domIdx / ndomX) % ndomY;
+        const int k = domIdx / (ndomX * ndomY);
 
         // left physical boundary
         if (i == 0) {
@@ -1087,36 +1381,230 @@ auto create_subdomains(
             bcFront = getPhysBCs(probId, pda::impl::GhostRelativeLocation::Front);
         }
 
+        if (tiling.dim() == 3) {
+            // bottom physical boundary
+            if (k == 0) {
+                bcBottom = getPhysBCs(probId, pda::impl::GhostRelativeLocation::Bottom);
+            }
+
+            // top physical boundary
+            if (k == (ndomZ - 1)) {
+                bcTop = getPhysBCs(probId, pda::impl::GhostRelativeLocation::Top);
+            }
+        }
+
         if (domFlagVec[domIdx] == "FOM") {
-            result.emplace_back(std::make_shared<SubdomainFOM<mesh_t, app_t, prob_t>>(
+            result[domIdx] = std::make_shared<SubdomainFOM<mesh_t, app_t, prob_t>>(
                 domIdx, meshes[domIdx],
                 bcLeft, bcFront, bcRight, bcBack,
-                probId, odeSchemes[domIdx], fluxOrders[domIdx], icFlag, icFileRoot, userParams));
+                probId, odeSchemes[domIdx], fluxOrders[domIdx], icFlag, icFileRoot, userParams,
+                bcBottom, bcTop);
         }
         else if (domFlagVec[domIdx] == "LSPG") {
-            result.emplace_back(std::make_shared<SubdomainLSPG<mesh_t, app_t, prob_t>>(
+            result[domIdx] = std::make_shared<SubdomainLSPG<mesh_t, app_t, prob_t>>(
                 domIdx, meshes[domIdx],
                 bcLeft, bcFront, bcRight, bcBack,
                 probId, odeSchemes[domIdx], fluxOrders[domIdx], icFlag, icFileRoot, userParams,
-                transRoot, basisRoot, nmodesVec[domIdx]));
+                transRoot, basisRoot, nmodesVec[domIdx],
+                bcBottom, bcTop);
         }
         else if (domFlagVec[domIdx] == "LSPGHyper") {
-            result.emplace_back(std::make_shared<SubdomainLSPGHyper<mesh_t, app_t, prob_t>>(
+            result[domIdx] = std::make_shared<SubdomainLSPGHyper<mesh_t, app_t, prob_t>>(
                 domIdx, meshes[domIdx],
                 bcLeft, bcFront, bcRight, bcBack,
                 probId, odeSchemes[domIdx], fluxOrders[domIdx], icFlag, icFileRoot, userParams,
                 transRoot, basisRoot, nmodesVec[domIdx],
                 samplePaths[domIdx],
-                weigher_type, basisRoot_gpod, nmodesVec_gpod_in[domIdx]));
+                weigher_type, basisRoot_gpod, nmodesVec_gpod_in[domIdx],
+                bcBottom, bcTop);
         }
-        else {
-            std::runtime_error("Invalid subdomain flag value: " + domFlagVec[domIdx]);
+    };
+
+    if (pool) {
+        // see create_meshes
+        auto futures = pool->submit_loop<int>(0, ndomains, create_subdomain);
+        futures.wait();
+        futures.get();
+    }
+    else {
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            create_subdomain(domIdx);
         }
     }
 
     return result;
 }
 
+template<class app_t, class mesh_t, class prob_t>
+auto create_subdomains(
+    const std::vector<mesh_t> & meshes,
+    const Tiling & tiling,
+    prob_t probId,
+    std::vector<pode::StepScheme> & odeSchemes,
+    std::vector<pda::InviscidFluxReconstruction> & fluxOrders,
+    const std::vector<std::string> & domFlagVec,
+    const std::string & transRoot,
+    const std::string & basisRoot,
+    const std::vector<int> & nmodesVec,
+    int icFlag = 0,
+    const std::string & icFileRoot = "",
+    const std::vector<std::string> & samplePaths = {},
+    const std::string & weigher_type = "identity",
+    const std::string & basisRoot_gpod = "",
+    const std::vector<int> & nmodesVec_gpod = {},
+    const std::unordered_map<std::string, typename app_t::scalar_type> & userParams = {})
+{
+    return create_subdomains_impl<app_t>(
+        nullptr, nullptr, meshes, tiling, probId, odeSchemes, fluxOrders,
+        domFlagVec, transRoot, basisRoot, nmodesVec,
+        icFlag, icFileRoot, samplePaths,
+        weigher_type, basisRoot_gpod, nmodesVec_gpod, userParams);
+}
+
+//
+// same as above, subdomains (basis reads, problem instances) are constructed concurrently on the thread pool
+//
+template<class app_t, class mesh_t, class prob_t>
+auto create_subdomains(
+    BS::thread_pool & pool,
+    const std::vector<mesh_t> & meshes,
+    const Tiling & tiling,
+    prob_t probId,
+    std::vector<pode::StepScheme> & odeSchemes,
+    std::vector<pda::InviscidFluxReconstruction> & fluxOrders,
+    const std::vector<std::string> & domFlagVec,
+    const std::string & transRoot,
+    const std::string & basisRoot,
+    const std::vector<int> & nmodesVec,
+    int icFlag = 0,
+    const std::string & icFileRoot = "",
+    const std::vector<std::string> & samplePaths = {},
+    const std::string & weigher_type = "identity",
+    const std::string & basisRoot_gpod = "",
+    const std::vector<int> & nmodesVec_gpod = {},
+    const std::unordered_map<std::string, typename app_t::scalar_type> & userParams = {})
+{
+    return create_subdomains_impl<app_t>(
+        &pool, nullptr, meshes, tiling, probId, odeSchemes, fluxOrders,
+        domFlagVec, transRoot, basisRoot, nmodesVec,
+        icFlag, icFileRoot, samplePaths,
+        weigher_type, basisRoot_gpod, nmodesVec_gpod, userParams);
+}
+
+template<class app_t, class mesh_t, class prob_t>
+auto create_fom_subdomains_impl(
+    BS::thread_pool * pool,
+    const std::vector<char> * ownedVec,
+    const std::vector<mesh_t> & meshes,
+    const Tiling & tiling,
+    prob_t probId,
+    std::vector<pode::StepScheme> & odeSchemes,
+    std::vector<pda::InviscidFluxReconstruction> & fluxOrders,
+    int icFlag,
+    const std::unordered_map<std::string, typename app_t::scalar_type> & userParams)
+{
+    auto ndomains = tiling.count();
+    std::vector<std::string> domFlagVec(ndomains, "FOM");
+
+    // dummy arguments
+    std::vector<int> nmodesVec(ndomains, -1);
+    std::vector<std::string> samplePaths(ndomains, "");
+    std::vector<int> nmodesVec_gpod(ndomains, -1);
+
+    return create_subdomains_impl<app_t>(
+        pool, ownedVec, meshes, tiling,
+        probId, odeSchemes, fluxOrders,
+        domFlagVec, "", "", nmodesVec,
+        icFlag, "", samplePaths,
+        "identity", "", nmodesVec_gpod,
+        userParams);
+}
+
+
+//
+// all domains are assumed to be FOM domains
+//
+template<class app_t, class mesh_t, class prob_t>
+auto create_subdomains(
+    const std::vector<mesh_t> & meshes,
+    const Tiling & tiling,
+    prob_t probId,
+    std::vector<pode::StepScheme> & odeSchemes,
+    std::vector<pda::InviscidFluxReconstruction> & fluxOrders,
+    int icFlag = 0,
+    const std::unordered_map<std::string, typename app_t::scalar_type> & userParams = {})
+{
+    return create_fom_subdomains_impl<app_t>(
+        nullptr, nullptr, meshes, tiling, probId, odeSchemes, fluxOrders, icFlag, userParams);
+}
+
+//
+// all domains are assumed to be FOM domains, constructed concurrently on the thread pool
+//
+template<class app_t, class mesh_t, class prob_t>
+auto create_subdomains(
+    BS::thread_pool & pool,
+    const std::vector<mesh_t> & meshes,
+    const Tiling & tiling,
+    prob_t probId,
+    std::vector<pode::StepScheme> & odeSchemes,
+    std::vector<pda::InviscidFluxReconstruction> & fluxOrders,
+    int icFlag = 0,
+    const std::unordered_map<std::string, typename app_t::scalar_type> & userParams = {})
+{
+    return create_fom_subdomains_impl<app_t>(
+        &pool, nullptr, meshes, tiling, probId, odeSchemes, fluxOrders, icFlag, userParams);
+}
+
+//
+// same as create_subdomains, but only the subdomains flagged in ownedVec are constructed,
+//      the others are SubdomainInterface stand-ins (see SchwarzDecompMPI)
+//
+template<class app_t, class mesh_t, class prob_t>
+auto create_owned_subdomains(
+    const std::vector<char> & ownedVec,
+    const std::vector<mesh_t> & meshes,
+    const Tiling & tiling,
+    prob_t probId,
+    std::vector<pode::StepScheme> & odeSchemes,
+    std::vector<pda::InviscidFluxReconstruction> & fluxOrders,
+    const std::vector<std::string> & domFlagVec,
+    const std::string & transRoot,
+    const std::string & basisRoot,
+    const std::vector<int> & nmodesVec,
+    int icFlag = 0,
+    const std::string & icFileRoot = "",
+    const std::vector<std::string> & samplePaths = {},
+    const std::string & weigher_type = "identity",
+    const std::string & basisRoot_gpod = "",
+    const std::vector<int> & nmodesVec_gpod = {},
+    const std::unordered_map<std::string, typename app_t::scalar_type> & userParams = {})
+{
+    return create_subdomains_impl<app_t>(
+        nullptr, &ownedVec, meshes, tiling, probId, odeSchemes, fluxOrders,
+        domFlagVec, transRoot, basisRoot, nmodesVec,
+        icFlag, icFileRoot, samplePaths,
+        weigher_type, basisRoot_gpod, nmodesVec_gpod, userParams);
+}
+
+//
+// all domains are assumed to be FOM domains, only the ones flagged in ownedVec are constructed
+//
+template<class app_t, class mesh_t, class prob_t>
+auto create_owned_subdomains(
+    const std::vector<char> & ownedVec,
+    const std::vector<mesh_t> & meshes,
+    const Tiling & tiling,
+    prob_t probId,
+    std::vector<pode::StepScheme> & odeSchemes,
+    std::vector<pda::InviscidFluxReconstruction> & fluxOrders,
+    int icFlag = 0,
+    const std::unordered_map<std::string, typename app_t::scalar_type> & userParams = {})
+{
+    return create_fom_subdomains_impl<app_t>(
+        nullptr, &ownedVec, meshes, tiling, probId, odeSchemes, fluxOrders, icFlag, userParams);
+}
+
 }
 
 #endif
@@ -51,6 +51,8 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <algorithm>
+#include <array>
 
 
 namespace pschwarz{
@@ -63,6 +65,7 @@ struct Tiling
     explicit Tiling(const std::string & meshRoot){
         read_domain_info(meshRoot);
         calc_neighbor_dims();
+        calc_domain_colors();
     }
 
     void describe(){
@@ -73,6 +76,14 @@ struct Tiling
             << " ndomains = " << m_ndomains
             << " overlap = " << m_overlap
             << '\n';
+        const char * axes[3] = {"X", "Y", "Z"};
+        for (int axis = 0; axis < 3; ++axis) {
+            if (!m_cellsVec[axis].empty()) {
+                std::cout << " cells" << axes[axis] << " =";
+                for (const auto cells : m_cellsVec[axis]) { std::cout << " " << cells; }
+                std::cout << '\n';
+            }
+        }
     }
 
     int dim() const{ return m_dim; }
@@ -82,6 +93,11 @@ struct Tiling
     int countX() const { return m_ndomX; }
     int countY() const { return m_ndomY; }
     int countZ() const { return m_ndomZ; }
+    int color(int domIdx) const { return m_colorVec[domIdx]; }
+    int colorCount() const { return m_colorDomIdVec.size(); }
+    const auto & colorDomIdVec() const { return m_colorDomIdVec; }
+    // cells per slab along axis, excluding overlap, empty if info_domain.dat predates slab sizes
+    const std::vector<int> & cellCounts(int axis) const { return m_cellsVec[axis]; }
 
 private:
 
@@ -132,9 +148,25 @@ private:
                 m_overlap = stoi(colVal);
                 if (m_overlap < 0) throw std::runtime_error("overlap must be >= 0");
             }
+
+            // slab sizes, which need not be uniform
+            else if ((colVal == "cellsX") || (colVal == "cellsY") || (colVal == "cellsZ")){
+                auto & cells = m_cellsVec[colVal[5] - 'X'];
+                while (ss >> colVal) {
+                    cells.push_back(stoi(colVal));
+                    if (cells.back() < 1) throw std::runtime_error("slab cell counts must be >= 1");
+                }
+            }
         }
         source.close();
         m_ndomains = m_ndomX * m_ndomY * m_ndomZ;
+
+        const int ndomVec[3] = {m_ndomX, m_ndomY, m_ndomZ};
+        for (int axis = 0; axis < 3; ++axis) {
+            if (!m_cellsVec[axis].empty() && ((int) m_cellsVec[axis].size() != ndomVec[axis])) {
+                throw std::runtime_error("number of slab cell counts does not match number of subdomains");
+            }
+        }
     }
 
     void calc_neighbor_dims()
@@ -150,9 +182,9 @@ private:
             int k = {};
             i = domIdx % m_ndomX;
             if (m_dim > 1) {
-                j = domIdx / m_ndomX;
+                j = (domIdx / m_ndomX) % m_ndomY;
             }
-            if (m_dim == 2) {
+            if (m_dim > 2) {
                 k = domIdx / (m_ndomX * m_ndomY);
             }
 
@@ -198,6 +230,32 @@ private:
         }
     }
 
+    void calc_domain_colors()
+    {
+        // greedy coloring of the neighbor graph, such that no two neighboring
+        // subdomains share a color. For structured tilings visited in natural
+        // order this recovers red-black (checkerboard) ordering.
+        m_colorVec.resize(m_ndomains, -1);
+        int ncolors = 0;
+        for (int domIdx = 0; domIdx < m_ndomains; ++domIdx) {
+            std::vector<bool> taken(2 * m_dim + 1, false);
+            for (const auto neighDomIdx : m_exchDomIdVec[domIdx]) {
+                if ((neighDomIdx != -1) && (m_colorVec[neighDomIdx] != -1)) {
+                    taken[m_colorVec[neighDomIdx]] = true;
+                }
+            }
+            int colorIdx = 0;
+            while (taken[colorIdx]) { colorIdx++; }
+            m_colorVec[domIdx] = colorIdx;
+            ncolors = std::max(ncolors, colorIdx + 1);
+        }
+
+        m_colorDomIdVec.resize(ncolors);
+        for (int domIdx = 0; domIdx < m_ndomains; ++domIdx) {
+            m_colorDomIdVec[m_colorVec[domIdx]].push_back(domIdx);
+        }
+    }
+
 private:
 
     int m_dim = {};
@@ -206,8 +264,11 @@ private:
     int m_ndomZ = {};
     int m_overlap = {};
     int m_ndomains = {};
+    std::array<std::vector<int>, 3> m_cellsVec;
 
     std::vector<std::vector<int>> m_exchDomIdVec;
+    std::vector<int> m_colorVec;
+    std::vector<std::vector<int>> m_colorDomIdVec;
 };
 
 }
@@ -6,8 +6,11 @@ from math import floor
 import numpy as np
 
 
-def prep_dim(N, ndom, bounds):
+def prep_dim(N, ndom, bounds, slab_costs=None, min_cells=1):
     d = (bounds[1] - bounds[0]) / N
+    if slab_costs is not None:
+        return d, weighted_cell_counts(N, slab_costs, min_cells=min_cells)
+
     N_dom = [int(N / ndom)] * ndom
     fill = N - int(N / ndom) * ndom
     for idx in range(fill):
@@ -16,6 +19,45 @@ def prep_dim(N, ndom, bounds):
     return d, N_dom
 
 
+def weighted_cell_counts(N, slab_costs, min_cells=1):
+    # slab widths inversely proportional to the cost per cell, so that every slab costs about the same
+    # rounded by largest remainder, at least min_cells cells per slab
+    ndom = len(slab_costs)
+    min_cells = max(1, min_cells)
+    assert N >= ndom * min_cells
+    assert all([cost > 0.0 for cost in slab_costs])
+    weights = [1.0 / cost for cost in slab_costs]
+    ideal = [N * weight / sum(weights) for weight in weights]
+    N_dom = [max(min_cells, floor(cells)) for cells in ideal]
+    remainders = sorted(range(ndom), key=lambda idx: ideal[idx] - N_dom[idx], reverse=True)
+    idx = 0
+    while sum(N_dom) < N:
+        N_dom[remainders[idx % ndom]] += 1
+        idx += 1
+    while sum(N_dom) > N:
+        # slabs raised to the minimum are never trimmed
+        trimmable = [idx for idx in range(ndom) if N_dom[idx] > min_cells]
+        largest = max(trimmable, key=lambda idx: N_dom[idx] - ideal[idx])
+        N_dom[largest] -= 1
+
+    return N_dom
+
+
+def get_slab_costs(dom_costs, numdoms_list, dim):
+    # slab cuts are shared by every subdomain in the slab, so each slab is sized
+    #   by the mean cost per cell of its subdomains
+    slab_costs = [[] for _ in range(numdoms_list[dim])]
+    for dom_idx, cost in enumerate(dom_costs):
+        grid_idxs = [
+            dom_idx % numdoms_list[0],
+            int(dom_idx / numdoms_list[0]) % numdoms_list[1],
+            int(dom_idx / (numdoms_list[0] * numdoms_list[1])),
+        ]
+        slab_costs[grid_idxs[dim]].append(cost)
+
+    return [sum(costs) / len(costs) for costs in slab_costs]
+
+
 def prep_dom_dim(ndom, N_dom, overlap, bounds, d):
 
     # cells that need to be distributed into overlap regions
@@ -50,7 +92,7 @@ def prep_dom_dim(ndom, N_dom, overlap, bounds, d):
 
 
 def get_linear_index(numdoms_list, i, j, k):
-    return i + numdoms_list[0] * j + (numdoms_list[0] + numdoms_list[1]) * k
+    return i + numdoms_list[0] * j + (numdoms_list[0] * numdoms_list[1]) * k
 
 
 def main(
@@ -62,6 +104,7 @@ def main(
     outdir,
     mesh_script,
     stdout=False,
+    dom_costs=None,
 ):
 
     if not os.path.isdir(outdir):
@@ -83,8 +126,10 @@ def main(
     for dim in range(ndim):
         assert numcells_list[dim] > 0
         assert bounds_list[2*dim+1] > bounds_list[2*dim]
-        assert numdoms_list[ndim] > 0
+        assert numdoms_list[dim] > 0
     assert overlap >= 0
+    if dom_costs is not None:
+        assert len(dom_costs) == numdoms
     # TODO: permit periodic domains
 
     # domain dimensions
@@ -94,7 +139,10 @@ def main(
         dx_list[dim], ncells_dom_list[dim] = prep_dim(
             numcells_list[dim],
             numdoms_list[dim],
-            bounds_list[2*dim:2*dim+2]
+            bounds_list[2*dim:2*dim+2],
+            slab_costs=None if dom_costs is None else get_slab_costs(dom_costs, numdoms_list, dim),
+            # a slab must hold the overlap and stencil halo sent to its neighbors
+            min_cells=overlap + int((stencilsize - 1) / 2),
         )
 
     # subdomain dimensions
@@ -103,7 +151,7 @@ def main(
         # gridded indices
         dom_grid_idxs[dom_idx] = [
             dom_idx % numdoms_list[0],
-            int(dom_idx / numdoms_list[0]),
+            int(dom_idx / numdoms_list[0]) % numdoms_list[1],
             int(dom_idx / (numdoms_list[0] * numdoms_list[1])),
         ]
 
@@ -159,11 +207,8 @@ def main(
                 stencil_gids = connect[cell_idx, :]
 
                 x_idx = cell_idx % numcells_sub_list[0][i]
-                if ndim > 1:
-                    y_idx = int(cell_idx / numcells_sub_list[0][i])
-                if ndim == 3:
-                    z_idx = int(cell_idx / (numcells_sub_list[0][i] * numcells_sub_list[1][j]))
-
+                y_idx = int(cell_idx / numcells_sub_list[0][i]) % numcells_sub_list[1][j]
+                z_idx = int(cell_idx / (numcells_sub_list[0][i] * numcells_sub_list[1][j]))
 
                 for stencil_idx in range(int((stencilsize - 1) / 2)):
                     for axis_idx in range(ndim * 2):
@@ -178,7 +223,8 @@ def main(
                             if (axis_idx == 0) and (i != 0):
                                 numcells_list_neigh = [numcells_sub_list[dim][neigh_idx] for dim, neigh_idx in zip(range(3), [i-1, j, k])]
                                 dist = x_idx
-                                neigh_gid = (numcells_list_neigh[0] * (y_idx + 1)) - overlap - stencil_idx + dist - 1
+                                plane = z_idx * numcells_list_neigh[0] * numcells_list_neigh[1]
+                                neigh_gid = plane + (numcells_list_neigh[0] * (y_idx + 1)) - overlap - stencil_idx + dist - 1
                             # right subdomain (1D)
                             if ndim == 1:
                                 if (axis_idx == 1) and (i != numdoms_list[0] - 1):
@@ -190,22 +236,37 @@ def main(
                                 if (axis_idx == 1) and (j != numdoms_list[1] - 1):
                                     numcells_list_neigh = [numcells_sub_list[dim][neigh_idx] for dim, neigh_idx in zip(range(3), [i, j+1, k])]
                                     dist = numcells_sub_list[1][j] - y_idx - 1
-                                    neigh_gid = (overlap + stencil_idx - dist) * numcells_list_neigh[0] + x_idx
+                                    plane = z_idx * numcells_list_neigh[0] * numcells_list_neigh[1]
+                                    neigh_gid = plane + (overlap + stencil_idx - dist) * numcells_list_neigh[0] + x_idx
 
                                 # right boundary (2D)
                                 if (axis_idx == 2) and (i != numdoms_list[0] - 1):
                                     numcells_list_neigh = [numcells_sub_list[dim][neigh_idx] for dim, neigh_idx in zip(range(3), [i+1, j, k])]
                                     dist = numcells_sub_list[0][i] - x_idx - 1
-                                    neigh_gid = (numcells_list_neigh[0] * y_idx) + overlap + stencil_idx - dist
+                                    plane = z_idx * numcells_list_neigh[0] * numcells_list_neigh[1]
+                                    neigh_gid = plane + (numcells_list_neigh[0] * y_idx) + overlap + stencil_idx - dist
 
                                 # back boundary
                                 if (axis_idx == 3) and (j != 0):
                                     numcells_list_neigh = [numcells_sub_list[dim][neigh_idx] for dim, neigh_idx in zip(range(3), [i, j-1, k])]
                                     dist = y_idx
-                                    neigh_gid = (numcells_list_neigh[1] - 1 - overlap - stencil_idx + dist) * numcells_list_neigh[0] + x_idx
+                                    plane = z_idx * numcells_list_neigh[0] * numcells_list_neigh[1]
+                                    neigh_gid = plane + (numcells_list_neigh[1] - 1 - overlap - stencil_idx + dist) * numcells_list_neigh[0] + x_idx
 
                             if ndim == 3:
-                                raise ValueError("3D not completed")
+                                # bottom boundary
+                                if (axis_idx == 4) and (k != 0):
+                                    numcells_list_neigh = [numcells_sub_list[dim][neigh_idx] for dim, neigh_idx in zip(range(3), [i, j, k-1])]
+                                    dist = z_idx
+                                    plane = (numcells_list_neigh[2] - 1 - overlap - stencil_idx + dist) * numcells_list_neigh[0] * numcells_list_neigh[1]
+                                    neigh_gid = plane + y_idx * numcells_list_neigh[0] + x_idx
+
+                                # top boundary
+                                if (axis_idx == 5) and (k != numdoms_list[2] - 1):
+                                    numcells_list_neigh = [numcells_sub_list[dim][neigh_idx] for dim, neigh_idx in zip(range(3), [i, j, k+1])]
+                                    dist = numcells_sub_list[2][k] - z_idx - 1
+                                    plane = (overlap + stencil_idx - dist) * numcells_list_neigh[0] * numcells_list_neigh[1]
+                                    neigh_gid = plane + y_idx * numcells_list_neigh[0] + x_idx
 
                         f.write(f" {neigh_gid:8d}")
                 f.write("\n")
@@ -219,6 +280,8 @@ def main(
                 f.write("ndomZ %8d\n" % numdoms_list[2])
 
         f.write("overlap %8d\n" % overlap)
+        for dim in range(ndim):
+            f.write("cells" + ["X", "Y", "Z"][dim] + "".join([" %8d" % ncells for ncells in ncells_dom_list[dim]]) + "\n")
 
 if __name__ == "__main__":
 
@@ -291,6 +354,25 @@ if __name__ == "__main__":
             "If you pass > 0, will use non-overlapping Dirichlet-Neumann coupling",
     )
 
+    # cost-weighted slabs
+    parser.add_argument(
+        "--domCosts", "--domcosts", "--dom_costs",
+        nargs="*",
+        type=float,
+        dest="domcosts",
+        help="Relative cost per cell of each subdomain, in linear subdomain order.\n"+
+            "If passed, slabs along each axis are sized inversely to the mean cost\n"+
+            "per cell of their subdomains, instead of having equal cell counts.",
+    )
+
+    parser.add_argument(
+        "--domCostFile", "--domcostfile", "--dom_cost_file",
+        dest="domcostfile",
+        help="Same as --domCosts, read from a file with one value per line,\n"+
+            "e.g. written by SchwarzDecomp::write_domain_costs() for a previous decomposition\n"+
+            "with the same number of subdomains.",
+    )
+
     # these should NOT change for now
     # TODO: allow for handling periodic BCs
     periodic = False
@@ -299,6 +381,10 @@ if __name__ == "__main__":
     argobj = parser.parse_args()
 
     # NOTE: input checks are peformed in main()
+    assert (argobj.domcosts is None) or (argobj.domcostfile is None)
+    dom_costs = argobj.domcosts
+    if argobj.domcostfile is not None:
+        dom_costs = np.loadtxt(argobj.domcostfile, ndmin=1).tolist()
 
     main(
         argobj.numcells,
@@ -309,4 +395,5 @@ if __name__ == "__main__":
         argobj.outdir,
         argobj.mesh_script,
         stdout=True,
+        dom_costs=dom_costs,
     )
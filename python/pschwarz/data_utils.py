@@ -1,6 +1,7 @@
 import os
 from copy import deepcopy
 import struct
+import zlib
 from math import floor
 
 import numpy as np
@@ -104,7 +105,7 @@ def merge_domain_data(data_list, overlap, is_ts=True):
     for dom_idx in range(ndomains):
 
         i = dom_idx % ndom_list[0]
-        j = int(dom_idx / ndom_list[0])
+        j = int(dom_idx / ndom_list[0]) % ndom_list[1]
         k = int(dom_idx / (ndom_list[0] * ndom_list[1]))
 
         # data indices
@@ -170,7 +171,7 @@ def decompose_domain_data(
     for dom_idx in range(ndomains):
 
         i = dom_idx % ndom_list[0]
-        j = int(dom_idx / ndom_list[0])
+        j = int(dom_idx / ndom_list[0]) % ndom_list[1]
         k = int(dom_idx / (ndom_list[0] * ndom_list[1]))
 
         # x-direction
@@ -202,7 +203,7 @@ def load_info_domain(meshdir):
     ndom_list = [1 for _ in range(3)]
     with open(os.path.join(meshdir, "info_domain.dat"), "r") as f:
         for line in f:
-            label, val = line.split()
+            label, val = line.split()[:2]
             if label == "ndomX":
                 ndom_list[0] = int(val)
                 ndim += 1
@@ -322,7 +323,7 @@ def load_meshes(
             # decomposed meshes
             meshdir_sub = os.path.join(meshdir, "domain_" + str(dom_idx))
             i = dom_idx % ndom_list[0]
-            j = int(dom_idx / ndom_list[0])
+            j = int(dom_idx / ndom_list[0]) % ndom_list[1]
             k = int(dom_idx / (ndom_list[0] * ndom_list[1]))
             coords_sub[i][j][k] = load_mesh_single(meshdir_sub)
 
@@ -342,12 +343,51 @@ def load_meshes(
     return coords, coords_sub
 
 
+COMPRESSED_STREAM_MAGIC = b"PSCHWZ01"
+
+
+def decode_snapshot_stream(contents):
+    """Decodes a compressed observer stream (see SnapshotCompression in tests_cpp/observer.hpp)
+    into an array of shape (number of snapshots, dofs per snapshot)"""
+
+    assert contents[:8] == COMPRESSED_STREAM_MAGIC
+    snapshots = []
+    pos = 8
+    while pos < len(contents):
+        count, nbytes = struct.unpack("QQ", contents[pos:pos+16])
+        quant_step = struct.unpack("d", contents[pos+16:pos+24])[0]
+        pos += 24
+
+        # undo byte-shuffle
+        shuffled = np.frombuffer(zlib.decompress(contents[pos:pos+nbytes]), dtype=np.uint8)
+        pos += nbytes
+        raw = np.ascontiguousarray(np.reshape(shuffled, (8, count)).T)
+
+        if quant_step > 0.0:
+            snapshots.append(raw.view("<i8").ravel() * quant_step)
+        else:
+            snapshots.append(raw.view("<f8").ravel())
+
+    return np.stack(snapshots)
+
+
+def read_snapshot_file(filename):
+    """Concatenated snapshots from raw float64 or compressed observer output"""
+
+    with open(filename, "rb") as f:
+        magic = f.read(len(COMPRESSED_STREAM_MAGIC))
+    if magic == COMPRESSED_STREAM_MAGIC:
+        with open(filename, "rb") as f:
+            return decode_snapshot_stream(f.read()).ravel()
+    return np.fromfile(filename)
+
+
 def load_field_data_single(filename, coords, nvars):
 
     ndim = coords.shape[-1]
     meshdims = coords.shape[:-1]
     dofs = np.prod(meshdims) * nvars
-    sol = np.fromfile(filename)
+    sol = read_snapshot_file(filename)
     nt = round(np.size(sol) / dofs)
     sol = np.reshape(sol, (nvars,) + meshdims + (nt,), order="F")
     sol = np.transpose(sol, tuple(np.arange(1,ndim+1)) + (ndim+1, 0, ))
@@ -355,6 +395,78 @@ def load_field_data_single(filename, coords, nvars):
     return sol
 
 
+class SnapshotContainer:
+    """Random-access reader for single-file snapshot containers written by SnapshotContainer in
+    tests_cpp/observer.hpp. The file is memory-mapped, only the chunks actually accessed are read.
+
+    Layout: 48-byte header (magic, version, ndomains, alignment, index offset, number of chunks),
+    aligned chunks of float64 data, one per (subdomain, step), and an index of all chunks.
+    """
+
+    MAGIC = b"PSCHWSNP"
+    header_dtype = np.dtype([
+        ("magic", "S8"),
+        ("version", "<u8"),
+        ("ndomains", "<u8"),
+        ("alignment", "<u8"),
+        ("index_offset", "<u8"),
+        ("nchunks", "<u8"),
+    ])
+    index_dtype = np.dtype([
+        ("dom_idx", "<u8"),
+        ("step", "<i8"),
+        ("time", "<f8"),
+        ("offset", "<u8"),
+        ("count", "<u8"),
+    ])
+
+    def __init__(self, filename):
+        assert os.path.isfile(filename), f"No snapshot container at {filename}"
+        self.data = np.memmap(filename, dtype=np.uint8, mode="r")
+
+        header = self.data[:self.header_dtype.itemsize].view(self.header_dtype)[0]
+        assert header["magic"] == self.MAGIC, f"{filename} is not a snapshot container"
+        assert header["version"] == 1, f"Unsupported snapshot container version {header['version']}"
+        self.ndomains = int(header["ndomains"])
+
+        start = int(header["index_offset"])
+        end = start + int(header["nchunks"]) * self.index_dtype.itemsize
+        self.index = self.data[start:end].view(self.index_dtype)
+
+        # (dom_idx, step) -> chunk
+        self.lookup = {(int(entry["dom_idx"]), int(entry["step"])): idx for idx, entry in enumerate(self.index)}
+
+    def steps(self, dom_idx):
+        mask = self.index["dom_idx"] == dom_idx
+        return np.sort(self.index["step"][mask])
+
+    def times(self, dom_idx):
+        mask = self.index["dom_idx"] == dom_idx
+        order = np.argsort(self.index["step"][mask])
+        return self.index["time"][mask][order]
+
+    def read(self, dom_idx, step):
+        """Read-only view of the state of subdomain dom_idx at step"""
+        entry = self.index[self.lookup[(dom_idx, step)]]
+        offset = int(entry["offset"])
+        return self.data[offset:offset + 8 * int(entry["count"])].view(np.float64)
+
+
+def load_field_data_container(container, dom_idx, coords, nvars, steps=None):
+    """Same output as load_field_data_single, for selected steps of one subdomain of a container"""
+
+    if steps is None:
+        steps = container.steps(dom_idx)
+
+    ndim = coords.shape[-1]
+    meshdims = coords.shape[:-1]
+    sol = np.stack([container.read(dom_idx, step) for step in steps], axis=-1)
+    sol = np.reshape(sol, (nvars,) + meshdims + (len(steps),), order="F")
+    sol = np.transpose(sol, tuple(np.arange(1,ndim+1)) + (ndim+1, 0, ))
+
+    return sol
+
+
 def load_field_data(
     datadir,
     fileroot,
@@ -362,8 +474,9 @@ def load_field_data(
     coords=None,
     meshdir=None,
     merge_decomp=False,
+    steps=None,
 ):
-    """Loading field data from PDA binaries
+    """Loading field data from PDA binaries, or from a snapshot container "fileroot.pssnap"
 
     datadir: directory where binaries are stored
     fileroot: string preceding ".bin" for monolithic files, or "*_n.bin" for decomposed files
@@ -375,6 +488,7 @@ def load_field_data(
         For monolithic: required if coords not provided
         For decomposed: always required, to get decomposition info
     merge_decomp: whether to merge solution for decomposed solution
+    steps: list of steps to load, only for snapshot containers (default all steps), raises ValueError otherwise
     """
 
 
@@ -389,6 +503,8 @@ def load_field_data(
             assert meshdir is not None
             coords = load_mesh_single(meshdir)
 
+        if steps is not None:
+            raise ValueError("steps can only be selected from a snapshot container, not from monolithic binaries")
         filename = os.path.join(datadir, fileroot + ".bin")
         sol = load_field_data_single(filename, coords, nvars)
         sol_sub = None
@@ -405,15 +521,25 @@ def load_field_data(
             assert coords is not None
         ndomains = np.prod(ndom_list)
 
+        container_file = os.path.join(datadir, fileroot + ".pssnap")
+        container = SnapshotContainer(container_file) if os.path.isfile(container_file) else None
+        if container is not None:
+            assert container.ndomains == ndomains
+        elif steps is not None:
+            raise ValueError(f"steps can only be selected from a snapshot container, no {container_file} found")
+
         sol_sub = [[[None for _ in range(ndom_list[2])] for _ in range(ndom_list[1])] for _ in range(ndom_list[0])]
         for dom_idx in range(ndomains):
 
             # decomposed solutions
-            filename = os.path.join(datadir, f"{fileroot}_{dom_idx}.bin")
             i = dom_idx % ndom_list[0]
-            j = int(dom_idx / ndom_list[0])
+            j = int(dom_idx / ndom_list[0]) % ndom_list[1]
             k = int(dom_idx / (ndom_list[0] * ndom_list[1]))
-            sol_sub[i][j][k] = load_field_data_single(filename, coords[i][j][k], nvars)
+            if container is not None:
+                sol_sub[i][j][k] = load_field_data_container(container, dom_idx, coords[i][j][k], nvars, steps=steps)
+            else:
+                filename = os.path.join(datadir, f"{fileroot}_{dom_idx}.bin")
+                sol_sub[i][j][k] = load_field_data_single(filename, coords[i][j][k], nvars)
 
         # combine solution, if requested
         if merge_decomp:
@@ -575,6 +701,10 @@ def read_from_binary(infile):
     with open(infile, "rb") as f:
         contents = f.read()
 
+    # compressed snapshot streams are returned as (dofs, snapshots)
+    if contents[:8] == COMPRESSED_STREAM_MAGIC:
+        return decode_snapshot_stream(contents).T
+
     m, n = struct.unpack("QQ", contents[:16])
     data = struct.unpack("d"*m*n, contents[16:])
     data = np.reshape(np.array(data), (m, n), "F")
@@ -582,10 +712,49 @@ def read_from_binary(infile):
     return data
 
 
+PHASE_TABLE_MAGIC = b"PSCHWPH1"
+
+
+def read_phase_table(filename):
+    """Reads the per-subdomain phase timers written by Instrumentation::write_table."""
+
+    with open(filename, 'rb') as f:
+        contents = f.read()
+    assert contents[:8] == PHASE_TABLE_MAGIC, f"{filename} is not a phase table"
+
+    ndomains, nphases = struct.unpack('QQ', contents[8:24])
+    pos = 24
+    names = []
+    for _ in range(nphases):
+        names.append(contents[pos:pos+32].split(b"\0", 1)[0].decode())
+        pos += 32
+
+    seconds = np.zeros((ndomains, nphases))
+    calls = np.zeros((ndomains, nphases), dtype=np.uint64)
+    linear_iters = np.zeros(ndomains, dtype=np.uint64)
+    for dom_idx in range(ndomains):
+        seconds[dom_idx, :] = struct.unpack(f'{nphases}d', contents[pos:pos+8*nphases])
+        pos += 8 * nphases
+        calls[dom_idx, :] = struct.unpack(f'{nphases}Q', contents[pos:pos+8*nphases])
+        pos += 8 * nphases
+        linear_iters[dom_idx] = struct.unpack('Q', contents[pos:pos+8])[0]
+        pos += 8
+
+    return {
+        "phases": names,
+        "seconds": seconds,
+        "calls": calls,
+        "linear_iters": linear_iters,
+    }
+
+
 def read_runtimes(
     datadirs,
     dataroot,
+    phaseroot=None,
 ):
+    # if phaseroot is given, the per-subdomain phase table {phaseroot}.bin
+    # of each datadir is returned as a fourth list, see read_phase_table
 
     if isinstance(datadirs, str):
         datadirs = [datadirs]
@@ -594,6 +763,7 @@ def read_runtimes(
     runtimelist = [None for _ in range(ndata)]
     iterslist = [None for _ in range(ndata)]
     subiterslist = [None for _ in range(ndata)]
+    phaselist = [None for _ in range(ndata)]
     for data_idx, datadir in enumerate(datadirs):
 
         datafile = os.path.join(datadir, f"{dataroot}.bin")
@@ -621,4 +791,9 @@ def read_runtimes(
         subiterslist[data_idx] = nsubiters_tot
         runtimelist[data_idx] = runtime_tot
 
+        if phaseroot is not None:
+            phaselist[data_idx] = read_phase_table(os.path.join(datadir, f"{phaseroot}.bin"))
+
+    if phaseroot is not None:
+        return runtimelist, iterslist, subiterslist, phaselist
     return runtimelist, iterslist, subiterslist
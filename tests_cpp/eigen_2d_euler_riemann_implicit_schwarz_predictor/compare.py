@@ -0,0 +1,37 @@
+import numpy as np
+from pschwarz.data_utils import read_runtimes
+
+if __name__== "__main__":
+    nx = 13
+    ny = 13
+    fomTotDofs = nx * ny * 4
+    nsteps = 25
+
+    # predicted boundary states only change the starting point of the Schwarz iteration
+    allclose = []
+    for predictor in ["linear", "quadratic"]:
+        for dom_idx in range(4):
+            D_ref = np.fromfile(f"riemann2d_solution_none_{dom_idx}.bin")
+            D = np.fromfile(f"riemann2d_solution_{predictor}_{dom_idx}.bin")
+            D_ref = np.reshape(D_ref, (-1, fomTotDofs))
+            D = np.reshape(D, (-1, fomTotDofs))
+            assert D.shape == D_ref.shape
+            assert D.shape[0] == nsteps + 1
+            assert np.isnan(D).any() == False
+            allclose.append(np.allclose(D, D_ref, rtol=1e-6, atol=1e-8))
+
+    assert all(allclose)
+
+    # every subdomain predicts once per outer step, under its own phase
+    subiters = {}
+    for predictor in ["none", "linear", "quadratic"]:
+        _, iters, subiters[predictor], phases = read_runtimes(".", f"runtime_{predictor}", phaseroot=f"phases_{predictor}")
+        assert iters[0] == nsteps
+        predict_idx = phases[0]["phases"].index("predict")
+        expected_calls = 0 if predictor == "none" else nsteps
+        assert np.all(phases[0]["calls"][:, predict_idx] == expected_calls)
+        print(f"{predictor}: average Schwarz iterations {subiters[predictor][0] / nsteps}")
+
+    # interface states change smoothly over an outer step once the initial discontinuities have spread,
+    #   quadratic extrapolation can overshoot the fronts, so its iteration count is only reported
+    assert subiters["linear"][0] < subiters["none"][0]
@@ -57,6 +57,9 @@ int main()
         domFlagVec, transRoot, basisRoot, nmodesVec, icFlag, "",
         samplePaths);
     pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+#ifdef USE_LAZY_FULL_STATE
+    decomp.set_lazy_full_state(true);
+#endif
 
     // observer
     using state_t = decltype(decomp)::state_t;
@@ -0,0 +1,20 @@
+import numpy as np
+
+if __name__== "__main__":
+    nx = 18
+    ny = 18
+    fomTotDofs = nx * ny * 3
+
+    # continuing from the checkpoint must reproduce the uninterrupted hyper-reduced run
+    allclose = []
+    for dom_idx in range(4):
+        D_full = np.fromfile(f"swe_slipWall2d_solution_full_{dom_idx}.bin")
+        D_restart = np.fromfile(f"swe_slipWall2d_solution_restart_{dom_idx}.bin")
+        D_full = np.reshape(D_full, (-1, fomTotDofs))
+        D_restart = np.reshape(D_restart, (-1, fomTotDofs))
+        assert D_full.shape[0] == 51
+        assert D_restart.shape[0] == 26
+        assert np.isnan(D_restart).any() == False
+        allclose.append(np.allclose(D_restart, D_full[25:, :], rtol=1e-10, atol=1e-12))
+
+    assert all(allclose)
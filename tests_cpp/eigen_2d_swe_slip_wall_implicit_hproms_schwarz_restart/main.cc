@@ -0,0 +1,136 @@
+#include <chrono>
+#include "pressiodemoapps/swe2d.hpp"
+#include "pressio-schwarz/schwarz.hpp"
+#include "pressio-schwarz/rom_utils.hpp"
+#include "../observer.hpp"
+
+// Hyper-reduced LSPG version of the restart test: runs to tf writing a checkpoint halfway,
+// then restarts a fresh decomposition from the checkpoint (only the stencil and latent
+// states are stored) and runs to tf again. Also checks that a truncated checkpoint is rejected.
+
+int main()
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    // +++++ USER INPUTS +++++
+    std::string meshRootFull = "./full_mesh_decomp";
+    std::string meshRootHyper = "./sample_mesh_decomp";
+    std::string obsRoot = "swe_slipWall2d_solution";
+    std::string checkpointFile = "checkpoint.bin";
+    std::string truncatedFile = "checkpoint_truncated.bin";
+    const int obsFreq = 1;
+
+    // problem definition
+    const auto probId = pda::Swe2d::CustomBCs;
+    std::vector<pda::InviscidFluxReconstruction> orderVec(4, pda::InviscidFluxReconstruction::FirstOrder);
+    std::vector<pode::StepScheme> schemeVec(4, pode::StepScheme::BDF1);
+    const int icFlag = 1;
+    using app_t = pschwarz::swe2d_app_type;
+
+    // ROM definition
+    std::vector<std::string> domFlagVec(4, "LSPGHyper");
+    std::string transRoot = "./trial_space/center";
+    std::string basisRoot = "./trial_space/basis";
+    std::vector<int> nmodesVec(4, 25);
+
+    // time stepping
+    const double tf = 1.0;
+    std::vector<double> dt(1, 0.02);
+    const int convergeStepMax = 10;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-11;
+
+    // +++++ END USER INPUTS +++++
+
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRootFull);
+    auto [meshObjsFull, meshPathsFull] = pschwarz::create_meshes(meshRootFull, tiling->count());
+    std::vector<std::string> samplePaths;
+    for (int domIdx = 0; domIdx < meshPathsFull.size(); ++ domIdx) {
+        samplePaths.emplace_back(meshRootHyper + "/domain_" + std::to_string(domIdx) + "/sample_mesh_gids.dat");
+    }
+
+    for (const std::string runLabel : {"full", "restart"}) {
+
+        auto subdomains = pschwarz::create_subdomains<app_t>(
+            meshObjsFull, *tiling, probId, schemeVec, orderVec,
+            domFlagVec, transRoot, basisRoot, nmodesVec, icFlag, "",
+            samplePaths);
+        pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+        const int numSteps = tf / decomp.m_dtMax;
+        const int checkpointStep = numSteps / 2;
+
+        int startStep = 0;
+        double time = 0.0;
+        if (runLabel == "restart") {
+            // a truncated file must fail validation before any subdomain state is touched
+            bool rejected = false;
+            try {
+                decomp.read_checkpoint(truncatedFile);
+            }
+            catch (const std::runtime_error & e) {
+                std::cout << "truncated checkpoint rejected: " << e.what() << std::endl;
+                rejected = true;
+            }
+            if (!rejected) {
+                std::cerr << "truncated checkpoint was not rejected" << std::endl;
+                return 1;
+            }
+
+            std::tie(startStep, time) = decomp.read_checkpoint(checkpointFile);
+        }
+
+        // observer
+        using state_t = decltype(decomp)::state_t;
+        using obs_t = FomObserver<state_t>;
+        std::vector<obs_t> obsVec((*decomp.m_tiling).count());
+        for (int domIdx = 0; domIdx < (*decomp.m_tiling).count(); ++domIdx) {
+            obsVec[domIdx] = obs_t(obsRoot + "_" + runLabel + "_" + std::to_string(domIdx) + ".bin", obsFreq);
+            obsVec[domIdx](::pressio::ode::StepCount(startStep), time, *decomp.m_subdomainVec[domIdx]->getStateFull());
+        }
+
+        RuntimeObserver obs_time("runtime_" + runLabel + ".bin");
+
+        // solve
+        for (int outerStep = startStep + 1; outerStep <= numSteps; ++outerStep)
+        {
+            std::cout << "Step " << outerStep << std::endl;
+
+            auto runtimeStart = std::chrono::high_resolution_clock::now();
+            auto numSubiters = decomp.calc_controller_step(
+                pschwarz::SchwarzMode::Multiplicative,
+                outerStep,
+                time,
+                rel_err_tol,
+                abs_err_tol,
+                convergeStepMax
+            );
+            const auto runtimeEnd = std::chrono::high_resolution_clock::now();
+            const auto nsDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(runtimeEnd - runtimeStart);
+            const double secsElapsed = static_cast<double>(nsDuration.count()) * 1e-9;
+
+            time += decomp.m_dtMax;
+
+            // output observer
+            if ((outerStep % obsFreq) == 0) {
+                const auto stepWrap = pode::StepCount(outerStep);
+                for (int domIdx = 0; domIdx < (*decomp.m_tiling).count(); ++domIdx) {
+                    obsVec[domIdx](stepWrap, time, *decomp.m_subdomainVec[domIdx]->getStateFull());
+                }
+            }
+
+            // runtime observer
+            obs_time(secsElapsed, numSubiters);
+
+            if ((runLabel == "full") && (outerStep == checkpointStep)) {
+                decomp.write_checkpoint(checkpointFile, outerStep, time);
+                std::filesystem::copy_file(checkpointFile, truncatedFile,
+                                           std::filesystem::copy_options::overwrite_existing);
+                std::filesystem::resize_file(truncatedFile, std::filesystem::file_size(checkpointFile) - sizeof(double));
+            }
+        }
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,98 @@
+#include <chrono>
+#include <fstream>
+#include "pressiodemoapps/swe2d.hpp"
+#include "pressio-schwarz/schwarz.hpp"
+#include "../observer.hpp"
+
+int main(int argc, char *argv[])
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    // +++++ USER INPUTS +++++
+    std::string meshRoot = "./mesh";
+    const std::string runLabel = (argc >= 2) ? argv[1] : "none";
+    std::string obsRoot = "swe_slipWall2d_solution_" + runLabel;
+    const int obsFreq = 1;
+
+    // problem definition
+    const auto probId = pda::Swe2d::CustomBCs;
+    std::vector<pda::InviscidFluxReconstruction> orderVec(9, pda::InviscidFluxReconstruction::FirstOrder);
+    std::vector<pode::StepScheme> schemeVec(9, pode::StepScheme::BDF1);
+    const int icFlag = 1;
+    using app_t = pschwarz::swe2d_app_type;
+
+    // time stepping
+    const double tf = 0.5;
+    std::vector<double> dt(1, 0.02);
+    const int convergeStepMax = 50;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-11;
+
+    // +++++ END USER INPUTS +++++
+
+    // tiling, meshes, and decomposition
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRoot);
+    auto [meshObjs, meshPaths] = pschwarz::create_meshes(meshRoot, tiling->count());
+    auto subdomains = pschwarz::create_subdomains<app_t>(
+        meshObjs, *tiling,
+        probId, schemeVec, orderVec, icFlag);
+    pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+    if (runLabel == "aitken") {
+        decomp.set_interface_accelerator(pschwarz::InterfaceAccel::Aitken, 5, 1.0, 1.5);
+    }
+    else if (runLabel == "anderson") {
+        decomp.set_interface_accelerator(pschwarz::InterfaceAccel::Anderson, 3, 1.0);
+    }
+    else if (runLabel != "none") {
+        throw std::runtime_error("Invalid accelerator " + runLabel);
+    }
+
+    // observer
+    using state_t = decltype(decomp)::state_t;
+    using obs_t = FomObserver<state_t>;
+    std::vector<obs_t> obsVec((*decomp.m_tiling).count());
+    for (int domIdx = 0; domIdx < (*decomp.m_tiling).count(); ++domIdx) {
+        obsVec[domIdx] = obs_t(obsRoot + "_" + std::to_string(domIdx) + ".bin", obsFreq);
+        obsVec[domIdx](::pressio::ode::StepCount(0), 0.0, *decomp.m_subdomainVec[domIdx]->getStateFull());
+    }
+    RuntimeObserver obs_time("runtime_" + runLabel + ".bin");
+    // absolute and relative error of the last Schwarz iteration of each step
+    std::ofstream errFile("errors_" + runLabel + ".bin", std::ios::out | std::ios::binary);
+
+    // solve
+    const int numSteps = tf / decomp.m_dtMax;
+    double time = 0.0;
+    for (int outerStep = 1; outerStep <= numSteps; ++outerStep)
+    {
+        std::cout << "Step " << outerStep << std::endl;
+
+        // compute contoller step until convergence
+        auto runtimeStart = std::chrono::high_resolution_clock::now();
+        auto numSubiters = decomp.calc_controller_step(
+            pschwarz::SchwarzMode::Additive,
+            outerStep,
+            time,
+            rel_err_tol,
+            abs_err_tol,
+            convergeStepMax
+        );
+        const auto runtimeEnd = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::milli> duration = runtimeEnd - runtimeStart;
+        obs_time(duration.count() * 1e-3, numSubiters);
+        errFile.write(reinterpret_cast<const char*>(&decomp.m_ae), sizeof(double));
+        errFile.write(reinterpret_cast<const char*>(&decomp.m_re), sizeof(double));
+
+        time += decomp.m_dtMax;
+
+        // output observer
+        if ((outerStep % obsFreq) == 0) {
+            const auto stepWrap = pode::StepCount(outerStep);
+            for (int domIdx = 0; domIdx < (*decomp.m_tiling).count(); ++domIdx) {
+                obsVec[domIdx](stepWrap, time, *decomp.m_subdomainVec[domIdx]->getStateFull());
+            }
+        }
+    }
+
+  return 0;
+}
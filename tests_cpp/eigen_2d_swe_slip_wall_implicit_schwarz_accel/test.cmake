@@ -0,0 +1,27 @@
+include(FindUnixCommands)
+
+set(CMD "python3 ${DECOMPDRIVER} --meshScript ${MESHDRIVER} -n 60 60 --outDir ${OUTDIR}/mesh -s ${STENCILVAL} --bounds -5.0 5.0 -5.0 5.0 --numDoms 3 3 --overlap 6")
+message(NOTICE ${CMD})
+execute_process(COMMAND ${BASH} -c ${CMD} RESULT_VARIABLE RES)
+if(RES)
+  message(FATAL_ERROR "Mesh generation failed")
+else()
+  message("Mesh generation succeeded!")
+endif()
+
+foreach(ACCEL none aitken anderson)
+  execute_process(COMMAND ${EXENAME} ${ACCEL} RESULT_VARIABLE CMD_RESULT)
+  if(CMD_RESULT)
+    message(FATAL_ERROR "run failed")
+  else()
+    message("run succeeded!")
+  endif()
+endforeach()
+
+set(CMD "python3 compare.py")
+execute_process(COMMAND ${BASH} -c ${CMD} RESULT_VARIABLE RES)
+if(RES)
+  message(FATAL_ERROR "comparison failed")
+else()
+  message("comparison succeeded!")
+endif()
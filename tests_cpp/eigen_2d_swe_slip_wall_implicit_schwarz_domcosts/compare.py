@@ -0,0 +1,41 @@
+import numpy as np
+from pschwarz.data_utils import load_field_data
+
+
+def load_slab_cells(meshdir):
+    cells = {}
+    with open(f"{meshdir}/info_domain.dat", "r") as f:
+        for line in f:
+            label, *vals = line.split()
+            if label.startswith("cells"):
+                cells[label] = [int(val) for val in vals]
+    return cells
+
+
+if __name__== "__main__":
+    nx = 30
+    ny = 30
+    # overlap plus stencil halo
+    min_cells = 7
+
+    # slab widths are inversely proportional to the mean cost of the slab
+    assert load_slab_cells("mesh_uniform") == {"cellsX": [15, 15], "cellsY": [15, 15]}
+    assert load_slab_cells("mesh_weighted") == {"cellsX": [23, 7], "cellsY": [15, 15]}
+
+    # measured costs are noisy, but must give valid slabs
+    costs = np.loadtxt("dom_costs_uniform.dat")
+    assert costs.shape == (4,)
+    assert np.all(costs > 0.0)
+    cells = load_slab_cells("mesh_measured")
+    assert sum(cells["cellsX"]) == nx
+    assert sum(cells["cellsY"]) == ny
+    assert all([count >= min_cells for counts in cells.values() for count in counts])
+
+    # the converged solution does not depend on where the slabs are cut
+    sol_ref, _ = load_field_data(".", "swe_slipWall2d_solution_uniform", 3, meshdir="mesh_uniform", merge_decomp=True)
+    assert sol_ref.shape == (nx, ny, 51, 3)
+    assert np.isnan(sol_ref).any() == False
+    for label in ["weighted", "measured"]:
+        sol, _ = load_field_data(".", f"swe_slipWall2d_solution_{label}", 3, meshdir=f"mesh_{label}", merge_decomp=True)
+        assert sol.shape == sol_ref.shape
+        assert np.allclose(sol, sol_ref, rtol=1e-5, atol=1e-7)
@@ -0,0 +1,135 @@
+#include <algorithm>
+#include "pressiodemoapps/swe2d.hpp"
+#include "pressio-schwarz/schwarz.hpp"
+#include "../observer.hpp"
+
+// Runs the same problem on equal slabs, on slabs sized by fixed subdomain costs, and on slabs
+// sized by the costs measured in the equal slab run. Checks that the slab cell counts read by
+// Tiling agree with the subdomain meshes.
+
+// subdomain meshes along an axis span their slab plus the overlap shared with each neighbor
+template<class mesh_t>
+int check_slab_cells(const pschwarz::Tiling & tiling, const std::vector<mesh_t> & meshObjs)
+{
+    int nfailed = 0;
+    for (int axis = 0; axis < tiling.dim(); ++axis) {
+        const auto & cells = tiling.cellCounts(axis);
+        const int nslabs = (axis == 0) ? tiling.countX() : tiling.countY();
+        if ((int) cells.size() != nslabs) {
+            std::cerr << "axis " << axis << ": expected " << nslabs << " slab cell counts\n";
+            nfailed++;
+            continue;
+        }
+
+        int meshCells = 0;
+        for (int slabIdx = 0; slabIdx < nslabs; ++slabIdx) {
+            const int domIdx = (axis == 0) ? slabIdx : slabIdx * tiling.countX();
+            const auto & mesh = meshObjs[domIdx];
+            const auto & coords = (axis == 0) ? mesh.viewX() : mesh.viewY();
+            const double width = (axis == 0) ? mesh.dx() : mesh.dy();
+            double lo = coords(0);
+            double hi = coords(0);
+            for (int cellIdx = 1; cellIdx < mesh.sampleMeshSize(); ++cellIdx) {
+                lo = std::min(lo, coords(cellIdx));
+                hi = std::max(hi, coords(cellIdx));
+            }
+            const int domCells = std::round((hi - lo) / width) + 1;
+            if (domCells < cells[slabIdx]) {
+                std::cerr << "axis " << axis << ", slab " << slabIdx << ": " << domCells
+                          << " mesh cells, fewer than " << cells[slabIdx] << '\n';
+                nfailed++;
+            }
+            meshCells += domCells;
+        }
+
+        int slabCells = 0;
+        for (const auto count : cells) { slabCells += count; }
+        if (meshCells != slabCells + tiling.overlap() * (nslabs - 1)) {
+            std::cerr << "axis " << axis << ": slab cell counts do not add up to the subdomain meshes\n";
+            nfailed++;
+        }
+    }
+    return nfailed;
+}
+
+int main(int argc, char *argv[])
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    // +++++ USER INPUTS +++++
+    const std::string runLabel = (argc >= 2) ? argv[1] : "uniform";
+    std::string meshRoot = "./mesh_" + runLabel;
+    std::string obsRoot = "swe_slipWall2d_solution_" + runLabel;
+    const int obsFreq = 1;
+
+    // problem definition
+    const auto probId = pda::Swe2d::CustomBCs;
+    std::vector<pda::InviscidFluxReconstruction> orderVec(4, pda::InviscidFluxReconstruction::FirstOrder);
+    std::vector<pode::StepScheme> schemeVec(4, pode::StepScheme::BDF1);
+    const int icFlag = 1;
+    using app_t = pschwarz::swe2d_app_type;
+
+    // time stepping
+    const double tf = 1.0;
+    std::vector<double> dt(1, 0.02);
+    const int convergeStepMax = 50;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-8;
+
+    // +++++ END USER INPUTS +++++
+
+    // tiling, meshes, and decomposition
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRoot);
+    tiling->describe();
+    auto [meshObjs, meshPaths] = pschwarz::create_meshes(meshRoot, tiling->count());
+    if (check_slab_cells(*tiling, meshObjs) != 0) {
+        return 1;
+    }
+    auto subdomains = pschwarz::create_subdomains<app_t>(
+        meshObjs, *tiling,
+        probId, schemeVec, orderVec, icFlag);
+    pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+
+    // observer
+    using state_t = decltype(decomp)::state_t;
+    using obs_t = FomObserver<state_t>;
+    std::vector<obs_t> obsVec((*decomp.m_tiling).count());
+    for (int domIdx = 0; domIdx < (*decomp.m_tiling).count(); ++domIdx) {
+        obsVec[domIdx] = obs_t(obsRoot + "_" + std::to_string(domIdx) + ".bin", obsFreq);
+        obsVec[domIdx](::pressio::ode::StepCount(0), 0.0, *decomp.m_subdomainVec[domIdx]->getStateFull());
+    }
+
+    // solve
+    const int numSteps = tf / decomp.m_dtMax;
+    double time = 0.0;
+    for (int outerStep = 1; outerStep <= numSteps; ++outerStep)
+    {
+        std::cout << "Step " << outerStep << std::endl;
+
+        // compute contoller step until convergence
+        const int numSubiters = decomp.calc_controller_step(
+            pschwarz::SchwarzMode::Multiplicative,
+            outerStep,
+            time,
+            rel_err_tol,
+            abs_err_tol,
+            convergeStepMax
+        );
+        std::cout << "Schwarz iterations: " << numSubiters << std::endl;
+
+        time += decomp.m_dtMax;
+
+        // output observer
+        if ((outerStep % obsFreq) == 0) {
+            const auto stepWrap = pode::StepCount(outerStep);
+            for (int domIdx = 0; domIdx < (*decomp.m_tiling).count(); ++domIdx) {
+                obsVec[domIdx](stepWrap, time, *decomp.m_subdomainVec[domIdx]->getStateFull());
+            }
+        }
+    }
+
+    decomp.write_domain_costs("dom_costs_" + runLabel + ".dat");
+
+  return 0;
+}
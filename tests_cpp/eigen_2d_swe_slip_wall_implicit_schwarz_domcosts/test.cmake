@@ -0,0 +1,50 @@
+include(FindUnixCommands)
+
+# equal slabs, whose run writes the measured subdomain costs
+set(CMD "python3 ${DECOMPDRIVER} --meshScript ${MESHDRIVER} -n 30 30 --outDir ${OUTDIR}/mesh_uniform -s ${STENCILVAL} --bounds -5.0 5.0 -5.0 5.0 --numDoms 2 2 --overlap 6")
+message(NOTICE ${CMD})
+execute_process(COMMAND ${BASH} -c ${CMD} RESULT_VARIABLE RES)
+if(RES)
+  message(FATAL_ERROR "Mesh generation failed")
+else()
+  message("Mesh generation succeeded!")
+endif()
+
+execute_process(COMMAND ${EXENAME} uniform RESULT_VARIABLE CMD_RESULT)
+if(CMD_RESULT)
+  message(FATAL_ERROR "run failed")
+else()
+  message("run succeeded!")
+endif()
+
+# slabs sized by fixed costs, and by the measured costs
+foreach(COSTS "--domCosts 1.0 3.0 1.0 3.0" "--domCostFile ${OUTDIR}/dom_costs_uniform.dat")
+  if(COSTS MATCHES "domCostFile")
+    set(LABEL measured)
+  else()
+    set(LABEL weighted)
+  endif()
+  set(CMD "python3 ${DECOMPDRIVER} --meshScript ${MESHDRIVER} -n 30 30 --outDir ${OUTDIR}/mesh_${LABEL} -s ${STENCILVAL} --bounds -5.0 5.0 -5.0 5.0 --numDoms 2 2 --overlap 6 ${COSTS}")
+  message(NOTICE ${CMD})
+  execute_process(COMMAND ${BASH} -c ${CMD} RESULT_VARIABLE RES)
+  if(RES)
+    message(FATAL_ERROR "Mesh generation failed")
+  else()
+    message("Mesh generation succeeded!")
+  endif()
+
+  execute_process(COMMAND ${EXENAME} ${LABEL} RESULT_VARIABLE CMD_RESULT)
+  if(CMD_RESULT)
+    message(FATAL_ERROR "run failed")
+  else()
+    message("run succeeded!")
+  endif()
+endforeach()
+
+set(CMD "python3 compare.py")
+execute_process(COMMAND ${BASH} -c ${CMD} RESULT_VARIABLE RES)
+if(RES)
+  message(FATAL_ERROR "comparison failed")
+else()
+  message("comparison succeeded!")
+endif()
@@ -0,0 +1,31 @@
+import numpy as np
+from pschwarz.data_utils import read_phase_table, read_runtimes
+
+if __name__== "__main__":
+    nx = 24
+    ny = 24
+    fomTotDofs = nx * ny * 3
+
+    # frozen subdomains have unchanged inputs, so freezing must not change the solution
+    allclose = []
+    for dom_idx in range(9):
+        D_ref = np.fromfile(f"swe_slipWall2d_solution_none_{dom_idx}.bin")
+        D = np.fromfile(f"swe_slipWall2d_solution_freeze_{dom_idx}.bin")
+        D_ref = np.reshape(D_ref, (-1, fomTotDofs))
+        D = np.reshape(D, (-1, fomTotDofs))
+        assert D.shape == D_ref.shape
+        assert D.shape[0] == 26
+        assert np.isnan(D).any() == False
+        allclose.append(np.allclose(D, D_ref, rtol=1e-6, atol=1e-8))
+
+    assert all(allclose)
+
+    # without freezing every subdomain steps once per Schwarz iteration, with freezing
+    #   the subdomains the initial wave has not reached yet are skipped
+    _, _, subiters, phases = read_runtimes(".", "runtime_none", phaseroot="phases_none")
+    step_idx = phases[0]["phases"].index("step")
+    assert np.all(phases[0]["calls"][:, step_idx] == subiters[0])
+
+    _, _, subiters, phases = read_runtimes(".", "runtime_freeze", phaseroot="phases_freeze")
+    assert np.all(phases[0]["calls"][:, step_idx] <= subiters[0])
+    assert np.sum(phases[0]["calls"][:, step_idx]) < 9 * subiters[0]
@@ -0,0 +1,39 @@
+import struct
+import numpy as np
+
+
+def read_subiters(filename):
+    contents = open(filename, "rb").read()
+    assert len(contents) > 0
+    return np.array([struct.unpack("Q", contents[nbytes_read:nbytes_read+8])[0]
+                     for nbytes_read in range(0, len(contents), 16)])
+
+
+if __name__== "__main__":
+    nx = 24
+    ny = 24
+    fomTotDofs = nx * ny * 3
+    convergeStepMax = 50
+    tol = 1e-11
+
+    subiters = {}
+    for metric in ["fullstate", "interface", "max"]:
+
+        # every step converged, and the reported error of its last iteration is below tolerance
+        subiters[metric] = read_subiters(f"runtime_{metric}.bin")
+        assert subiters[metric].size == 25
+        assert np.all(subiters[metric] < convergeStepMax)
+        errs = np.reshape(np.fromfile(f"errors_{metric}.bin"), (-1, 2))
+        assert errs.shape[0] == 25
+        assert np.all((errs[:, 0] < tol) | (errs[:, 1] < tol))
+
+        # all metrics converge to the same solution
+        for dom_idx in range(9):
+            D_ref = np.fromfile(f"swe_slipWall2d_solution_fullstate_{dom_idx}.bin")
+            D = np.fromfile(f"swe_slipWall2d_solution_{metric}_{dom_idx}.bin")
+            assert D.shape == D_ref.shape
+            assert np.isnan(D).any() == False
+            assert np.allclose(D, D_ref, rtol=1e-6, atol=1e-8)
+
+    # the largest subdomain error is never below the average one
+    assert np.sum(subiters["max"]) >= np.sum(subiters["fullstate"])
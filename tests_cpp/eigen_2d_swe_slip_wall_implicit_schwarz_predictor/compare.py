@@ -0,0 +1,41 @@
+import struct
+import numpy as np
+
+
+def load_subiters(filename):
+    contents = open(filename, "rb").read()
+    nsubiters = []
+    for nbytes_read in range(0, len(contents), 16):
+        nsubiters.append(struct.unpack("Q", contents[nbytes_read:nbytes_read+8])[0])
+    return np.array(nsubiters)
+
+
+if __name__== "__main__":
+    nx = 18
+    ny = 18
+    fomTotDofs = nx * ny * 3
+
+    # predicted boundary states only change the starting point of the Schwarz iteration
+    allclose = []
+    for predictor in ["linear", "quadratic"]:
+        for dom_idx in range(4):
+            D_ref = np.fromfile(f"swe_slipWall2d_solution_none_{dom_idx}.bin")
+            D = np.fromfile(f"swe_slipWall2d_solution_{predictor}_{dom_idx}.bin")
+            D_ref = np.reshape(D_ref, (-1, fomTotDofs))
+            D = np.reshape(D, (-1, fomTotDofs))
+            assert D.shape == D_ref.shape
+            assert D.shape[0] == 51
+            assert np.isnan(D).any() == False
+            allclose.append(np.allclose(D, D_ref, rtol=1e-6, atol=1e-8))
+
+    assert all(allclose)
+
+    # ... and should take fewer Schwarz iterations per step
+    subiters = {}
+    for predictor in ["none", "linear", "quadratic"]:
+        subiters[predictor] = load_subiters(f"runtime_{predictor}.bin")
+        assert subiters[predictor].size == 50
+        print(f"{predictor}: average Schwarz iterations {np.mean(subiters[predictor])}")
+
+    assert np.mean(subiters["linear"]) < np.mean(subiters["none"])
+    assert np.mean(subiters["quadratic"]) < np.mean(subiters["none"])
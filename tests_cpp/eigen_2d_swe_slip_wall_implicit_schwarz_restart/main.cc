@@ -0,0 +1,135 @@
+#include <chrono>
+#include "pressiodemoapps/swe2d.hpp"
+#include "pressio-schwarz/schwarz.hpp"
+#include "../observer.hpp"
+
+// Runs to tf, writing a checkpoint halfway, then restarts a fresh decomposition from
+// the checkpoint and runs to tf again. Checkpoint write/restore is timed against
+// writing/reading per-subdomain full-state snapshots (the icFileRoot format).
+
+int main()
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    // +++++ USER INPUTS +++++
+    std::string meshRoot = "./mesh";
+    std::string obsRoot = "swe_slipWall2d_solution";
+    std::string checkpointFile = "checkpoint.bin";
+    std::string snapshotRoot = "snapshot_";
+    const int obsFreq = 1;
+
+    // problem definition
+    const auto probId = pda::Swe2d::CustomBCs;
+    std::vector<pda::InviscidFluxReconstruction> orderVec(4, pda::InviscidFluxReconstruction::FirstOrder);
+    std::vector<pode::StepScheme> schemeVec(4, pode::StepScheme::BDF1);
+    const int icFlag = 1;
+    using app_t = pschwarz::swe2d_app_type;
+
+    // time stepping
+    const double tf = 1.0;
+    std::vector<double> dt(1, 0.02);
+    const int convergeStepMax = 10;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-11;
+
+    // +++++ END USER INPUTS +++++
+
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRoot);
+    auto [meshObjs, meshPaths] = pschwarz::create_meshes(meshRoot, tiling->count());
+
+    for (const std::string runLabel : {"full", "restart"}) {
+
+        auto subdomains = pschwarz::create_subdomains<app_t>(
+            meshObjs, *tiling,
+            probId, schemeVec, orderVec, icFlag);
+        pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+        const int numSteps = tf / decomp.m_dtMax;
+        const int checkpointStep = numSteps / 2;
+
+        int startStep = 0;
+        double time = 0.0;
+        if (runLabel == "restart") {
+            auto runtimeStart = std::chrono::steady_clock::now();
+            std::tie(startStep, time) = decomp.read_checkpoint(checkpointFile);
+            auto runtimeEnd = std::chrono::steady_clock::now();
+            std::cout << "checkpoint restore: "
+                      << std::chrono::duration<double>(runtimeEnd - runtimeStart).count() << " s\n";
+
+            runtimeStart = std::chrono::steady_clock::now();
+            for (int domIdx = 0; domIdx < tiling->count(); ++domIdx) {
+                auto snapshot = pschwarz::read_vector_from_binary<double>(snapshotRoot + std::to_string(domIdx) + ".bin");
+            }
+            runtimeEnd = std::chrono::steady_clock::now();
+            std::cout << "snapshot restore: "
+                      << std::chrono::duration<double>(runtimeEnd - runtimeStart).count() << " s\n";
+        }
+
+        // observer
+        using state_t = decltype(decomp)::state_t;
+        using obs_t = FomObserver<state_t>;
+        std::vector<obs_t> obsVec((*decomp.m_tiling).count());
+        for (int domIdx = 0; domIdx < (*decomp.m_tiling).count(); ++domIdx) {
+            obsVec[domIdx] = obs_t(obsRoot + "_" + runLabel + "_" + std::to_string(domIdx) + ".bin", obsFreq);
+            obsVec[domIdx](::pressio::ode::StepCount(startStep), time, *decomp.m_subdomainVec[domIdx]->getStateFull());
+        }
+
+        RuntimeObserver obs_time("runtime_" + runLabel + ".bin");
+
+        // solve
+        for (int outerStep = startStep + 1; outerStep <= numSteps; ++outerStep)
+        {
+            std::cout << "Step " << outerStep << std::endl;
+
+            auto runtimeStart = std::chrono::high_resolution_clock::now();
+            auto numSubiters = decomp.calc_controller_step(
+                pschwarz::SchwarzMode::Multiplicative,
+                outerStep,
+                time,
+                rel_err_tol,
+                abs_err_tol,
+                convergeStepMax
+            );
+            const auto runtimeEnd = std::chrono::high_resolution_clock::now();
+            const auto nsDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(runtimeEnd - runtimeStart);
+            const double secsElapsed = static_cast<double>(nsDuration.count()) * 1e-9;
+
+            time += decomp.m_dtMax;
+
+            // output observer
+            if ((outerStep % obsFreq) == 0) {
+                const auto stepWrap = pode::StepCount(outerStep);
+                for (int domIdx = 0; domIdx < (*decomp.m_tiling).count(); ++domIdx) {
+                    obsVec[domIdx](stepWrap, time, *decomp.m_subdomainVec[domIdx]->getStateFull());
+                }
+            }
+
+            // runtime observer
+            obs_time(secsElapsed, numSubiters);
+
+            if ((runLabel == "full") && (outerStep == checkpointStep)) {
+                auto runtimeStart = std::chrono::steady_clock::now();
+                decomp.write_checkpoint(checkpointFile, outerStep, time);
+                auto runtimeEnd = std::chrono::steady_clock::now();
+                std::cout << "checkpoint write: "
+                          << std::chrono::duration<double>(runtimeEnd - runtimeStart).count() << " s, "
+                          << std::filesystem::file_size(checkpointFile) << " bytes\n";
+
+                std::uintmax_t snapshotBytes = 0;
+                runtimeStart = std::chrono::steady_clock::now();
+                for (int domIdx = 0; domIdx < (*decomp.m_tiling).count(); ++domIdx) {
+                    const auto snapshotFile = snapshotRoot + std::to_string(domIdx) + ".bin";
+                    pschwarz::write_matrix_to_binary(snapshotFile, *decomp.m_subdomainVec[domIdx]->getStateFull());
+                    snapshotBytes += std::filesystem::file_size(snapshotFile);
+                }
+                runtimeEnd = std::chrono::steady_clock::now();
+                std::cout << "snapshot write: "
+                          << std::chrono::duration<double>(runtimeEnd - runtimeStart).count() << " s, "
+                          << snapshotBytes << " bytes\n";
+            }
+        }
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,28 @@
+import numpy as np
+
+from pschwarz.data_utils import decode_snapshot_stream
+
+
+def decode(filename):
+    with open(filename, "rb") as f:
+        return decode_snapshot_stream(f.read())
+
+
+if __name__== "__main__":
+    nx = 18
+    ny = 18
+    fomTotDofs = nx * ny * 3
+    quant_tol = 1e-8
+
+    for dom_idx in range(4):
+        D_raw = np.reshape(np.fromfile(f"swe_slipWall2d_solution_raw_{dom_idx}.bin"), (-1, fomTotDofs))
+        assert D_raw.shape[0] == 51
+
+        # lossless must be bit-exact
+        D_lossless = decode(f"swe_slipWall2d_solution_lossless_{dom_idx}.bin")
+        assert np.array_equal(D_lossless, D_raw)
+
+        # quantized error is bounded pointwise
+        D_quant = decode(f"swe_slipWall2d_solution_quantized_{dom_idx}.bin")
+        assert D_quant.shape == D_raw.shape
+        assert np.max(np.abs(D_quant - D_raw)) <= quant_tol * (1.0 + 1e-6)
@@ -0,0 +1,113 @@
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include "pressiodemoapps/swe2d.hpp"
+#include "pressio-schwarz/schwarz.hpp"
+#include "../observer.hpp"
+
+// Writes every snapshot of a Schwarz SWE run raw, compressed losslessly, and quantized,
+// and reports the compression ratio and write throughput of each.
+// Snapshots are written synchronously, so that the timings include the codec.
+
+int main()
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    // +++++ USER INPUTS +++++
+    std::string meshRoot = "./mesh";
+    std::string obsRoot = "swe_slipWall2d_solution";
+    const int obsFreq = 1;
+    const double quantTol = 1e-8;
+
+    // problem definition
+    const auto probId = pda::Swe2d::CustomBCs;
+    std::vector<pda::InviscidFluxReconstruction> orderVec(4, pda::InviscidFluxReconstruction::FirstOrder);
+    std::vector<pode::StepScheme> schemeVec(4, pode::StepScheme::BDF1);
+    const int icFlag = 1;
+    using app_t = pschwarz::swe2d_app_type;
+
+    // time stepping
+    const double tf = 1.0;
+    std::vector<double> dt(1, 0.02);
+    const int convergeStepMax = 10;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-11;
+
+    // +++++ END USER INPUTS +++++
+
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRoot);
+    auto [meshObjs, meshPaths] = pschwarz::create_meshes(meshRoot, tiling->count());
+    auto subdomains = pschwarz::create_subdomains<app_t>(
+        meshObjs, *tiling,
+        probId, schemeVec, orderVec, icFlag);
+    pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+    const int ndomains = (*decomp.m_tiling).count();
+
+    // observers
+    using state_t = decltype(decomp)::state_t;
+    using obs_t = FomObserver<state_t>;
+    const std::vector<std::string> labels = {"raw", "lossless", "quantized"};
+    const std::vector<SnapshotCompression> codecs = {{false, 0.0}, {true, 0.0}, {true, quantTol}};
+    std::vector<obs_t> obsVec(labels.size() * ndomains);
+    std::vector<double> writeSecs(labels.size(), 0.0);
+    std::vector<std::string> fileNames;
+    for (std::size_t codecIdx = 0; codecIdx < labels.size(); ++codecIdx) {
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            fileNames.emplace_back(obsRoot + "_" + labels[codecIdx] + "_" + std::to_string(domIdx) + ".bin");
+            obsVec[codecIdx * ndomains + domIdx] = obs_t(fileNames.back(), obsFreq, nullptr, codecs[codecIdx]);
+        }
+    }
+
+    auto observe = [&](const int step, const double time) {
+        const auto stepWrap = pode::StepCount(step);
+        for (std::size_t codecIdx = 0; codecIdx < labels.size(); ++codecIdx) {
+            const auto runtimeStart = std::chrono::steady_clock::now();
+            for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+                obsVec[codecIdx * ndomains + domIdx](stepWrap, time, *decomp.m_subdomainVec[domIdx]->getStateFull());
+            }
+            const auto runtimeEnd = std::chrono::steady_clock::now();
+            writeSecs[codecIdx] += std::chrono::duration<double>(runtimeEnd - runtimeStart).count();
+        }
+    };
+    observe(0, 0.0);
+
+    // solve
+    std::uintmax_t rawBytes = 0;
+    const int numSteps = tf / decomp.m_dtMax;
+    double time = 0.0;
+    for (int outerStep = 1; outerStep <= numSteps; ++outerStep)
+    {
+        auto numSubiters = decomp.calc_controller_step(
+            pschwarz::SchwarzMode::Multiplicative,
+            outerStep,
+            time,
+            rel_err_tol,
+            abs_err_tol,
+            convergeStepMax
+        );
+        std::cout << "Step " << outerStep << ", " << numSubiters << " Schwarz iterations" << std::endl;
+        time += decomp.m_dtMax;
+
+        if ((outerStep % obsFreq) == 0) {
+            observe(outerStep, time);
+        }
+    }
+    obsVec.clear();
+
+    // report
+    for (std::size_t codecIdx = 0; codecIdx < labels.size(); ++codecIdx) {
+        std::uintmax_t bytes = 0;
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            bytes += std::filesystem::file_size(fileNames[codecIdx * ndomains + domIdx]);
+        }
+        if (codecIdx == 0) { rawBytes = bytes; }
+        std::cout << std::left << std::setw(10) << labels[codecIdx]
+                  << " bytes: " << std::setw(12) << bytes
+                  << " ratio: " << std::setw(10) << static_cast<double>(rawBytes) / bytes
+                  << " write throughput (MB/s): " << rawBytes / writeSecs[codecIdx] * 1e-6 << '\n';
+    }
+
+    return 0;
+
+}
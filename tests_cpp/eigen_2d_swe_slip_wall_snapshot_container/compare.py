@@ -0,0 +1,40 @@
+import numpy as np
+
+from pschwarz.data_utils import SnapshotContainer, load_field_data
+
+
+if __name__== "__main__":
+    nx = 18
+    ny = 18
+    fomTotDofs = nx * ny * 3
+    nsteps = 51
+
+    # every chunk must be aligned and hold the same data as the per-subdomain files
+    container = SnapshotContainer("swe_slipWall2d_container.pssnap")
+    assert container.ndomains == 4
+    assert len(container.index) == 4 * nsteps
+    for dom_idx in range(4):
+        D = np.reshape(np.fromfile(f"swe_slipWall2d_solution_{dom_idx}.bin"), (-1, fomTotDofs))
+        assert D.shape[0] == nsteps
+        assert np.array_equal(container.steps(dom_idx), np.arange(nsteps))
+        assert np.allclose(container.times(dom_idx), 0.02 * np.arange(nsteps), rtol=0.0, atol=1e-12)
+        for step in range(nsteps):
+            entry = container.index[container.lookup[(dom_idx, step)]]
+            assert entry["offset"] % 64 == 0
+            assert np.array_equal(container.read(dom_idx, step), D[step, :])
+
+    # selected steps read from the container match the same steps of the full per-subdomain data
+    steps = [0, 10, 50]
+    _, sol_files = load_field_data(".", "swe_slipWall2d_solution", 3, meshdir="./mesh")
+    _, sol_container = load_field_data(".", "swe_slipWall2d_container", 3, meshdir="./mesh", steps=steps)
+    for i in range(2):
+        for j in range(2):
+            expected = np.take(sol_files[i][j][0], steps, axis=-2)
+            assert np.array_equal(sol_container[i][j][0], expected)
+
+    # step selection is only possible from a container
+    try:
+        load_field_data(".", "swe_slipWall2d_solution", 3, meshdir="./mesh", steps=steps)
+        assert False, "steps were silently ignored"
+    except ValueError:
+        pass
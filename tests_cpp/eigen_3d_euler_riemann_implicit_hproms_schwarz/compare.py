@@ -0,0 +1,21 @@
+import numpy as np
+
+
+if __name__== "__main__":
+
+    ndomains = 8
+    ndof = 5
+
+    # every FOM step lies in the trial space, so the hyper-reduced Schwarz solution
+    #   reproduces the FOM one, provided the neighbor connectivity is correct
+    for dom_idx in range(ndomains):
+        ncells = np.loadtxt(f"full_mesh_decomp/domain_{dom_idx}/coordinates.dat").shape[0]
+        fom = np.reshape(np.fromfile(f"riemann3d_solution_fom_{dom_idx}.bin"), (-1, ncells * ndof))
+        hyper = np.reshape(np.fromfile(f"riemann3d_solution_hyper_{dom_idx}.bin"), (-1, ncells * ndof))
+        assert fom.shape[0] == 6
+        assert hyper.shape == fom.shape
+        assert not np.isnan(hyper).any()
+
+        err = np.linalg.norm(hyper - fom, axis=1) / np.linalg.norm(fom, axis=1)
+        print(f"domain {dom_idx}: max relative error {err.max():.3e}")
+        assert err.max() < 1e-3
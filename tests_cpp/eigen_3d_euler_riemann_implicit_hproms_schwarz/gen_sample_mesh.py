@@ -0,0 +1,21 @@
+import os
+
+import numpy as np
+
+
+# random sample cells for every subdomain of the decomposed mesh
+# (pschwarz.samp_utils only handles 1D/2D meshes)
+
+meshdir = "./full_mesh_decomp"
+outdir = "./sample_mesh_decomp"
+ndomains = 8
+percpoints = 0.4
+
+for dom_idx in range(ndomains):
+    ncells = np.loadtxt(os.path.join(meshdir, f"domain_{dom_idx}", "coordinates.dat")).shape[0]
+    rng = np.random.default_rng(dom_idx)
+    samples = np.sort(rng.choice(ncells, size=int(ncells * percpoints), replace=False))
+
+    outdir_samps = os.path.join(outdir, f"domain_{dom_idx}")
+    os.makedirs(outdir_samps, exist_ok=True)
+    np.savetxt(os.path.join(outdir_samps, "sample_mesh_gids.dat"), samples, fmt='%8i')
@@ -0,0 +1,198 @@
+#include <chrono>
+#include <filesystem>
+#include "pressiodemoapps/euler3d.hpp"
+#include "pressio-schwarz/schwarz.hpp"
+#include "pressio-schwarz/rom_utils.hpp"
+#include "../observer.hpp"
+
+// Hyper-reduced LSPG Schwarz on a 2x2x2 tiling of the 3D Riemann problem, with randomly sampled
+// subdomains. The trial spaces are built from a FOM Schwarz run, so the hyper-reduced run reproduces it.
+// Also checks that the neighbor graphs built by calc_hyper_connectivity() point at the stencil mesh
+// cells of the neighboring subdomains at the expected locations.
+
+// header of two 8-byte sizes, followed by the column-major matrix, as read by read_matrix_from_binary
+template<class matrix_t>
+void write_matrix_to_binary(const std::string & fileName, const matrix_t & M)
+{
+    std::ofstream out(fileName, std::ios::binary);
+    const std::size_t rows = M.rows();
+    const std::size_t cols = M.cols();
+    out.write(reinterpret_cast<const char *>(&rows), sizeof(std::size_t));
+    out.write(reinterpret_cast<const char *>(&cols), sizeof(std::size_t));
+    out.write(reinterpret_cast<const char *>(M.data()), rows * cols * sizeof(double));
+}
+
+template<class decomp_t>
+int check_connectivity(decomp_t & decomp)
+{
+    // left, front, right, back, bottom, top
+    const int axis[6] = {0, 1, 0, 1, 2, 2};
+    const int sign[6] = {-1, 1, 1, -1, -1, 1};
+
+    const auto & tiling = *decomp.m_tiling;
+    const auto & exchDomIdVec = tiling.exchDomIdVec();
+    int nchecked = 0;
+    int nfailed = 0;
+    for (int domIdx = 0; domIdx < tiling.count(); ++domIdx) {
+        const auto & subdomain = *decomp.m_subdomainVec[domIdx];
+        const auto & meshFull = subdomain.getMeshFull();
+        const auto & meshStencil = subdomain.getMeshStencil();
+        const auto & sampGids = *subdomain.getSampleGids();
+        const auto & neighborGraph = subdomain.getNeighborGraph();
+        const std::array<double, 3> width = {meshFull.dx(), meshFull.dy(), meshFull.dz()};
+        const auto coords = [](const auto & mesh, const int idx) {
+            return std::array<double, 3>{mesh.viewX()(idx), mesh.viewY()(idx), mesh.viewZ()(idx)};
+        };
+        const auto matches = [&](const std::array<double, 3> & a, const std::array<double, 3> & b) {
+            for (int dimIdx = 0; dimIdx < 3; ++dimIdx) {
+                if (std::abs(a[dimIdx] - b[dimIdx]) > 1e-3 * width[dimIdx]) { return false; }
+            }
+            return true;
+        };
+
+        for (int sampIdx = 0; sampIdx < sampGids.rows(); ++sampIdx) {
+            const auto cell = coords(meshFull, sampGids(sampIdx));
+            if (!matches(cell, coords(meshStencil, neighborGraph(sampIdx, 0)))) {
+                std::cerr << "domain " << domIdx << ", sample " << sampIdx << ": wrong stencil mesh cell\n";
+                nfailed++;
+            }
+
+            for (int colIdx = 1; colIdx < neighborGraph.cols(); ++colIdx) {
+                const int stencilId = neighborGraph(sampIdx, colIdx);
+                if (stencilId == -1) {
+                    continue;  // inside this subdomain, or a physical boundary
+                }
+                const int neighIdx = (colIdx - 1) % 6;
+                const int layer = (colIdx - 1) / 6 + 1;
+                const int neighDomIdx = exchDomIdVec[domIdx][neighIdx];
+                auto expected = cell;
+                expected[axis[neighIdx]] += sign[neighIdx] * layer * width[axis[neighIdx]];
+                if ((neighDomIdx == -1) ||
+                    !matches(expected, coords(decomp.m_subdomainVec[neighDomIdx]->getMeshStencil(), stencilId))) {
+                    std::cerr << "domain " << domIdx << ", sample " << sampIdx << ", column " << colIdx
+                              << ": wrong neighbor cell\n";
+                    nfailed++;
+                }
+                nchecked++;
+            }
+        }
+    }
+    std::cout << "checked " << nchecked << " neighbor connections, " << nfailed << " wrong" << std::endl;
+    return ((nchecked > 0) && (nfailed == 0)) ? 0 : 1;
+}
+
+int main()
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    // +++++ USER INPUTS +++++
+    std::string meshRootFull = "./full_mesh_decomp";
+    std::string meshRootHyper = "./sample_mesh_decomp";
+    std::string trialRoot = "./trial_space";
+    std::string obsRoot = "riemann3d_solution";
+    const int obsFreq = 1;
+
+    // problem definition
+    const auto probId = pda::Euler3d::Riemann;
+    std::vector<pda::InviscidFluxReconstruction> orderVec(8, pda::InviscidFluxReconstruction::FirstOrder);
+    std::vector<pode::StepScheme> schemeVec(8, pode::StepScheme::BDF1);
+    const int icFlag = 1;
+    using app_t = pschwarz::euler3d_app_type;
+
+    // ROM definition
+    std::vector<std::string> domFlagVec(8, "LSPGHyper");
+    std::string transRoot = trialRoot + "/center";
+    std::string basisRoot = trialRoot + "/basis";
+
+    // time stepping
+    const double tf = 0.05;
+    std::vector<double> dt(1, 0.01);
+    const int convergeStepMax = 20;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-11;
+
+    // +++++ END USER INPUTS +++++
+
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRootFull);
+    tiling->describe();
+    auto [meshObjsFull, meshPathsFull] = pschwarz::create_meshes(meshRootFull, tiling->count());
+    std::vector<std::string> samplePaths;
+    for (int domIdx = 0; domIdx < tiling->count(); ++domIdx) {
+        samplePaths.emplace_back(meshRootHyper + "/domain_" + std::to_string(domIdx) + "/sample_mesh_gids.dat");
+    }
+
+    // runs the decomposition to tf, observing the full states
+    auto solve = [&](auto & decomp, const std::string & runLabel, auto && onStep) {
+        using state_t = typename std::remove_reference_t<decltype(decomp)>::state_t;
+        using obs_t = FomObserver<state_t>;
+        std::vector<obs_t> obsVec(tiling->count());
+        for (int domIdx = 0; domIdx < tiling->count(); ++domIdx) {
+            obsVec[domIdx] = obs_t(obsRoot + "_" + runLabel + "_" + std::to_string(domIdx) + ".bin", obsFreq);
+            obsVec[domIdx](pode::StepCount(0), 0.0, *decomp.m_subdomainVec[domIdx]->getStateFull());
+        }
+        onStep(0);
+
+        const int numSteps = std::round(tf / decomp.m_dtMax);
+        double time = 0.0;
+        for (int outerStep = 1; outerStep <= numSteps; ++outerStep)
+        {
+            std::cout << runLabel << " step " << outerStep << std::endl;
+            const int numSubiters = decomp.calc_controller_step(
+                pschwarz::SchwarzMode::Multiplicative, outerStep, time,
+                rel_err_tol, abs_err_tol, convergeStepMax);
+            std::cout << "Schwarz iterations: " << numSubiters << std::endl;
+            time += decomp.m_dtMax;
+
+            for (int domIdx = 0; domIdx < tiling->count(); ++domIdx) {
+                obsVec[domIdx](pode::StepCount(outerStep), time, *decomp.m_subdomainVec[domIdx]->getStateFull());
+            }
+            onStep(outerStep);
+        }
+    };
+
+    // FOM run, the trial space of each subdomain is centered on its initial condition
+    //      and spanned by the orthonormalized changes of its state over the run
+    {
+        auto subdomains = pschwarz::create_subdomains<app_t>(
+            meshObjsFull, *tiling, probId, schemeVec, orderVec, icFlag);
+        pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+
+        using state_t = decltype(decomp)::state_t;
+        std::vector<std::vector<state_t>> snapshots(tiling->count());
+        solve(decomp, "fom", [&](int) {
+            for (int domIdx = 0; domIdx < tiling->count(); ++domIdx) {
+                snapshots[domIdx].push_back(*decomp.m_subdomainVec[domIdx]->getStateFull());
+            }
+        });
+
+        std::filesystem::create_directories(trialRoot);
+        for (int domIdx = 0; domIdx < tiling->count(); ++domIdx) {
+            const auto & center = snapshots[domIdx][0];
+            Eigen::MatrixXd deltas(center.size(), snapshots[domIdx].size() - 1);
+            for (int snapIdx = 1; snapIdx < (int) snapshots[domIdx].size(); ++snapIdx) {
+                deltas.col(snapIdx - 1) = snapshots[domIdx][snapIdx] - center;
+            }
+            Eigen::HouseholderQR<Eigen::MatrixXd> qr(deltas);
+            const Eigen::MatrixXd basis = qr.householderQ() * Eigen::MatrixXd::Identity(deltas.rows(), deltas.cols());
+            write_matrix_to_binary(transRoot + "_" + std::to_string(domIdx) + ".bin", Eigen::MatrixXd(center));
+            write_matrix_to_binary(basisRoot + "_" + std::to_string(domIdx) + ".bin", basis);
+        }
+    }
+
+    // hyper-reduced run
+    const int nmodes = std::round(tf / dt[0]);
+    std::vector<int> nmodesVec(tiling->count(), nmodes);
+    auto subdomains = pschwarz::create_subdomains<app_t>(
+        meshObjsFull, *tiling, probId, schemeVec, orderVec,
+        domFlagVec, transRoot, basisRoot, nmodesVec, icFlag, "",
+        samplePaths);
+    pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+
+    if (check_connectivity(decomp) != 0) {
+        return 1;
+    }
+    solve(decomp, "hyper", [](int) {});
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+include(FindUnixCommands)
+
+set(CMD "python3 ${DECOMPDRIVER} --meshScript ${MESHDRIVER} -n 16 16 16 --outDir ${OUTDIR}/full_mesh_decomp -s ${STENCILVAL} --bounds 0.0 1.0 0.0 1.0 0.0 1.0 --numDoms 2 2 2 --overlap 4")
+message(NOTICE ${CMD})
+execute_process(COMMAND ${BASH} -c ${CMD} RESULT_VARIABLE RES)
+if(RES)
+  message(FATAL_ERROR "Full decomposed mesh generation failed")
+else()
+  message("Full decomposed mesh generation succeeded!")
+endif()
+
+set(CMD "python3 ./gen_sample_mesh.py")
+execute_process(COMMAND ${BASH} -c ${CMD} RESULT_VARIABLE RES)
+if(RES)
+  message(FATAL_ERROR "Sample mesh generation failed")
+else()
+  message("Sample mesh generation succeeded!")
+endif()
+
+execute_process(COMMAND ${EXENAME} RESULT_VARIABLE CMD_RESULT)
+if(CMD_RESULT)
+  message(FATAL_ERROR "run failed")
+else()
+  message("run succeeded!")
+endif()
+
+set(CMD "python3 compare.py")
+execute_process(COMMAND ${BASH} -c ${CMD} RESULT_VARIABLE RES)
+if(RES)
+  message(FATAL_ERROR "comparison failed")
+else()
+  message("comparison succeeded!")
+endif()
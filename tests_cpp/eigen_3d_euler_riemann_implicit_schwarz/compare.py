@@ -0,0 +1,33 @@
+import numpy as np
+
+
+if __name__== "__main__":
+
+    ndomains = 8
+    ndof = 5
+
+    # final states and cell centers of every subdomain
+    coords = []
+    states = []
+    for dom_idx in range(ndomains):
+        xyz = np.loadtxt(f"mesh/domain_{dom_idx}/coordinates.dat")[:, 1:]
+        D = np.fromfile(f"riemann3d_solution_{dom_idx}.bin")
+        nt = int(np.size(D) / (xyz.shape[0] * ndof))
+        assert nt == 11
+        D = np.reshape(D, (nt, xyz.shape[0], ndof))[-1, :, :]
+        assert not np.isnan(D).any()
+        coords.append(np.round(xyz, 10))
+        states.append(D)
+
+    # a converged Schwarz solution agrees wherever subdomains overlap,
+    #   which checks the exchange across all six faces
+    noverlap = 0
+    for dom_idx in range(ndomains):
+        cells = {tuple(c): cell_idx for cell_idx, c in enumerate(coords[dom_idx])}
+        for neigh_idx in range(dom_idx + 1, ndomains):
+            for neigh_cell_idx, c in enumerate(coords[neigh_idx]):
+                cell_idx = cells.get(tuple(c))
+                if cell_idx is not None:
+                    assert np.allclose(states[dom_idx][cell_idx], states[neigh_idx][neigh_cell_idx], rtol=1e-6, atol=1e-8)
+                    noverlap += 1
+    assert noverlap > 0
@@ -0,0 +1,85 @@
+#include <chrono>
+#include "pressiodemoapps/euler3d.hpp"
+#include "pressio-schwarz/schwarz.hpp"
+#include "../observer.hpp"
+
+// 3D Riemann problem on a 2x2x2 tiling, every subdomain has Schwarz boundaries on three faces
+
+int main()
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    // +++++ USER INPUTS +++++
+    std::string meshRoot = "./mesh";
+    std::string obsRoot = "riemann3d_solution";
+    const int obsFreq = 1;
+
+    // problem definition
+    const auto probId = pda::Euler3d::Riemann;
+    std::vector<pda::InviscidFluxReconstruction> orderVec(8, pda::InviscidFluxReconstruction::FirstOrder);
+    std::vector<pode::StepScheme> schemeVec(8, pode::StepScheme::BDF1);
+    const int icFlag = 1;
+    using app_t = pschwarz::euler3d_app_type;
+
+    // time stepping
+    const double tf = 0.1;
+    std::vector<double> dt(1, 0.01);
+    const int convergeStepMax = 20;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-11;
+
+    // +++++ END USER INPUTS +++++
+
+    // tiling, meshes, and decomposition
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRoot);
+    tiling->describe();
+    auto [meshObjs, meshPaths] = pschwarz::create_meshes(meshRoot, tiling->count());
+    auto subdomains = pschwarz::create_subdomains<app_t>(
+        meshObjs, *tiling, probId, schemeVec, orderVec, icFlag);
+    pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+
+    // observer
+    using state_t = decltype(decomp)::state_t;
+    using obs_t = FomObserver<state_t>;
+    std::vector<obs_t> obsVec(tiling->count());
+    for (int domIdx = 0; domIdx < tiling->count(); ++domIdx) {
+        obsVec[domIdx] = obs_t(obsRoot + "_" + std::to_string(domIdx) + ".bin", obsFreq);
+        obsVec[domIdx](::pressio::ode::StepCount(0), 0.0, *decomp.m_subdomainVec[domIdx]->getStateFull());
+    }
+
+    RuntimeObserver obs_time("runtime.bin");
+
+    // solve
+    const int numSteps = tf / decomp.m_dtMax;
+    double time = 0.0;
+    for (int outerStep = 1; outerStep <= numSteps; ++outerStep)
+    {
+        std::cout << "Step " << outerStep << std::endl;
+
+        auto runtimeStart = std::chrono::high_resolution_clock::now();
+        auto numSubiters = decomp.calc_controller_step(
+            pschwarz::SchwarzMode::Multiplicative,
+            outerStep,
+            time,
+            rel_err_tol,
+            abs_err_tol,
+            convergeStepMax
+        );
+        const auto runtimeEnd = std::chrono::high_resolution_clock::now();
+        const double secsElapsed = std::chrono::duration<double>(runtimeEnd - runtimeStart).count();
+
+        time += decomp.m_dtMax;
+
+        if ((outerStep % obsFreq) == 0) {
+            const auto stepWrap = pode::StepCount(outerStep);
+            for (int domIdx = 0; domIdx < tiling->count(); ++domIdx) {
+                obsVec[domIdx](stepWrap, time, *decomp.m_subdomainVec[domIdx]->getStateFull());
+            }
+        }
+
+        obs_time(secsElapsed, numSubiters);
+    }
+
+    return 0;
+}
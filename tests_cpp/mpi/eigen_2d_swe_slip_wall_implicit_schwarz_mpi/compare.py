@@ -0,0 +1,19 @@
+import numpy as np
+
+
+if __name__== "__main__":
+
+    nx = 30
+    ny = 40
+    fomTotDofs = nx * ny * 3
+
+    # distributed solution must match the sequential one
+    for mode in ["additive", "colored"]:
+        for dom_idx in range(12):
+            D_serial = np.fromfile(f"swe_slipWall2d_solution_{mode}_serial_{dom_idx}.bin")
+            D_mpi = np.fromfile(f"swe_slipWall2d_solution_{mode}_mpi_{dom_idx}.bin")
+            assert D_serial.shape == D_mpi.shape
+            nt = int(np.size(D_mpi) / fomTotDofs)
+            assert nt == 11
+            assert np.isnan(D_mpi).any() == False
+            assert np.allclose(D_mpi, D_serial, rtol=1e-10, atol=1e-12)
@@ -0,0 +1,102 @@
+#include <chrono>
+#include "pressiodemoapps/swe2d.hpp"
+#include "pressio-schwarz/schwarz_mpi.hpp"
+#include "../../observer.hpp"
+
+// Solves additive and colored multiplicative Schwarz distributed over all ranks, and
+// sequentially on rank 0. Every rank writes the solutions of the subdomains it owns,
+// which are compared against the sequential ones.
+
+int main(int argc, char *argv[])
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    MPI_Init(&argc, &argv);
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    // +++++ USER INPUTS +++++
+    std::string meshRoot = "./mesh";
+    std::string obsRoot = "swe_slipWall2d_solution";
+    const int obsFreq = 1;
+
+    // problem definition
+    const auto probId = pda::Swe2d::CustomBCs;
+    std::vector<pda::InviscidFluxReconstruction> orderVec(12, pda::InviscidFluxReconstruction::FirstOrder);
+    std::vector<pode::StepScheme> schemeVec(12, pode::StepScheme::BDF1);
+    const int icFlag = 1;
+    using app_t = pschwarz::swe2d_app_type;
+
+    // time stepping
+    const double tf = 0.2;
+    std::vector<double> dt(1, 0.02);
+    const int convergeStepMax = 10;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-11;
+
+    // +++++ END USER INPUTS +++++
+
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRoot);
+    auto [meshObjs, meshPaths] = pschwarz::create_meshes(meshRoot, tiling->count());
+
+    // runs the decomposition and writes the subdomains for which isWritten(domIdx)
+    auto solve = [&](auto & decomp, const std::string & fileRoot, pschwarz::SchwarzMode mode, auto && isWritten) {
+        using state_t = typename std::remove_reference_t<decltype(decomp)>::state_t;
+        using obs_t = FomObserver<state_t>;
+        const int ndomains = tiling->count();
+        std::vector<obs_t> obsVec(ndomains);
+        const auto observe = [&](const int step, const double time) {
+            for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+                if (isWritten(domIdx)) {
+                    obsVec[domIdx](pode::StepCount(step), time, *decomp.m_subdomainVec[domIdx]->getStateFull());
+                }
+            }
+        };
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            if (isWritten(domIdx)) {
+                obsVec[domIdx] = obs_t(fileRoot + "_" + std::to_string(domIdx) + ".bin", obsFreq);
+            }
+        }
+        observe(0, 0.0);
+
+        const int numSteps = tf / decomp.m_dtMax;
+        double time = 0.0;
+        for (int outerStep = 1; outerStep <= numSteps; ++outerStep)
+        {
+            (void) decomp.calc_controller_step(mode, outerStep, time, rel_err_tol, abs_err_tol, convergeStepMax);
+            time += decomp.m_dtMax;
+
+            if ((outerStep % obsFreq) == 0) {
+                observe(outerStep, time);
+            }
+        }
+    };
+
+    const std::vector<std::pair<std::string, pschwarz::SchwarzMode>> modes = {
+        {"additive", pschwarz::SchwarzMode::Additive},
+        {"colored", pschwarz::SchwarzMode::MultiplicativeColored}};
+
+    for (const auto & [modeLabel, mode] : modes) {
+        {
+            // subdomains of other ranks are interface-only stand-ins
+            auto subdomains = pschwarz::create_owned_subdomains<app_t>(
+                pschwarz::mpi_owned_domains(*tiling), meshObjs, *tiling, probId, schemeVec, orderVec, icFlag);
+            pschwarz::SchwarzDecompMPI decomp(subdomains, tiling, dt);
+            solve(decomp, obsRoot + "_" + modeLabel + "_mpi", mode,
+                  [&](int domIdx) { return decomp.is_local(domIdx); });
+        }
+
+        if (rank == 0) {
+            auto subdomains = pschwarz::create_subdomains<app_t>(
+                meshObjs, *tiling, probId, schemeVec, orderVec, icFlag);
+            pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+            solve(decomp, obsRoot + "_" + modeLabel + "_serial", mode,
+                  [](int) { return true; });
+        }
+        MPI_Barrier(MPI_COMM_WORLD);
+    }
+
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,15 @@
+import numpy as np
+
+
+if __name__== "__main__":
+
+    ndomains = 12
+
+    # the layout must not change the additive Schwarz solution
+    for dom_idx in range(ndomains):
+        ref = np.fromfile(f"thread_final_{dom_idx}.bin")
+        assert ref.size > 0
+        assert not np.isnan(ref).any()
+        for layout in ["mpi", "hybrid"]:
+            sol = np.fromfile(f"{layout}_final_{dom_idx}.bin")
+            assert np.allclose(sol, ref, rtol=1e-10, atol=1e-12)
@@ -0,0 +1,102 @@
+#include <chrono>
+#include "pressiodemoapps/swe2d.hpp"
+#include "pressio-schwarz/schwarz_mpi.hpp"
+#include "../../help_cmdline.hpp"
+
+// Times additive Schwarz on the 12-subdomain decomposition of the large slip wall case in three layouts:
+//      thread: SchwarzDecomp on a thread pool, on a single rank
+//      mpi:    SchwarzDecompMPI, one thread per rank
+//      hybrid: SchwarzDecompMPI with a thread pool per rank
+// Run as mpiexec -np <nranks> ./exe <numthreads> <layout> <meshRoot>,
+//      every rank writes the final solutions of the subdomains it owns for comparison.
+
+int main(int argc, char *argv[])
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    int rank, nranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nranks);
+
+    const int numthreads = parse_num_threads(argc, argv);
+    const std::string layout = (argc >= 3) ? argv[2] : "hybrid";
+    const std::string meshRoot = (argc >= 4) ? argv[3] : "./mesh";
+    if ((layout == "thread") && (nranks != 1)) {
+        throw std::runtime_error("thread layout runs on a single rank");
+    }
+
+    const auto probId = pda::Swe2d::CustomBCs;
+    using app_t = pschwarz::swe2d_app_type;
+    const int icFlag = 1;
+    std::vector<double> dt(1, 0.02);
+    const int numSteps = 10;
+    const int convergeStepMax = 10;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-11;
+
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRoot);
+    const int ndomains = tiling->count();
+    std::vector<pode::StepScheme> schemeVec(ndomains, pode::StepScheme::BDF1);
+    std::vector<pda::InviscidFluxReconstruction> orderVec(ndomains, pda::InviscidFluxReconstruction::FirstOrder);
+    auto [meshes, meshPaths] = pschwarz::create_meshes(meshRoot, ndomains);
+
+    BS::thread_pool pool(numthreads);
+
+    // runs the decomposition and writes the subdomains for which isWritten(domIdx)
+    auto solve = [&](auto & decomp, auto && step, auto && isWritten) {
+        int totalSubiters = 0;
+        double time = 0.0;
+        MPI_Barrier(MPI_COMM_WORLD);
+        const auto runtimeStart = std::chrono::steady_clock::now();
+        for (int outerStep = 1; outerStep <= numSteps; ++outerStep) {
+            totalSubiters += step(outerStep, time);
+            time += decomp.m_dtMax;
+        }
+        const auto runtimeEnd = std::chrono::steady_clock::now();
+
+        // slowest rank
+        double secs = std::chrono::duration<double>(runtimeEnd - runtimeStart).count();
+        MPI_Allreduce(MPI_IN_PLACE, &secs, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        if (rank == 0) {
+            std::cout << layout << " additive Schwarz, " << nranks << " ranks x " << numthreads << " threads, "
+                      << totalSubiters << " Schwarz iterations: " << secs << " s\n";
+        }
+
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            if (isWritten(domIdx)) {
+                const auto & state = *decomp.m_subdomainVec[domIdx]->getStateFull();
+                std::ofstream out(layout + "_final_" + std::to_string(domIdx) + ".bin", std::ios::binary);
+                out.write(reinterpret_cast<const char *>(state.data()), state.size() * sizeof(double));
+            }
+        }
+    };
+
+    if (layout == "thread") {
+        auto subdomains = pschwarz::create_subdomains<app_t>(
+            meshes, *tiling, probId, schemeVec, orderVec, icFlag);
+        pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+        solve(decomp,
+              [&](int outerStep, double time) {
+                  return decomp.additive_step(outerStep, time, rel_err_tol, abs_err_tol, convergeStepMax, pool);
+              },
+              [](int) { return true; });
+    }
+    else {
+        auto subdomains = pschwarz::create_owned_subdomains<app_t>(
+            pschwarz::mpi_owned_domains(*tiling), meshes, *tiling, probId, schemeVec, orderVec, icFlag);
+        pschwarz::SchwarzDecompMPI decomp(subdomains, tiling, dt);
+        solve(decomp,
+              [&](int outerStep, double time) {
+                  return (layout == "hybrid")
+                      ? decomp.additive_step(outerStep, time, rel_err_tol, abs_err_tol, convergeStepMax, pool)
+                      : decomp.additive_step(outerStep, time, rel_err_tol, abs_err_tol, convergeStepMax);
+              },
+              [&](int domIdx) { return decomp.is_local(domIdx); });
+    }
+
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,34 @@
+include(FindUnixCommands)
+
+# same 90x100 mesh as eigen_2d_swe_slip_wall_implicit_large, split into 4x3 subdomains
+# four cores in every layout: 1 rank x 4 threads, 4 ranks x 1 thread, 2 ranks x 2 threads
+set(LAYOUTS thread mpi hybrid)
+set(RANKS 1 4 2)
+set(THREADS 4 1 2)
+
+set(CMD "python3 ${DECOMPDRIVER} --meshScript ${MESHDRIVER} -n 90 100 --outDir ${OUTDIR}/mesh -s 3 --bounds -5.0 5.0 -5.0 5.0 --numDoms 4 3 --overlap 10")
+message(NOTICE ${CMD})
+execute_process(COMMAND ${BASH} -c ${CMD} RESULT_VARIABLE RES)
+if(RES)
+  message(FATAL_ERROR "Mesh generation failed")
+else()
+  message("Mesh generation succeeded!")
+endif()
+
+foreach(layout np nt IN ZIP_LISTS LAYOUTS RANKS THREADS)
+  set(CMD "${MPIEXEC} ${NPFLAG} ${np} ${MPIFLAGS} ${EXENAME} ${nt} ${layout} ${OUTDIR}/mesh")
+  message(NOTICE ${CMD})
+  execute_process(COMMAND ${BASH} -c ${CMD} WORKING_DIRECTORY ${OUTDIR} RESULT_VARIABLE CMD_RESULT)
+  if(CMD_RESULT)
+    message(FATAL_ERROR "${layout} run failed")
+  endif()
+endforeach()
+message("run succeeded!")
+
+set(CMD "python3 compare.py")
+execute_process(COMMAND ${BASH} -c ${CMD} WORKING_DIRECTORY ${OUTDIR} RESULT_VARIABLE RES)
+if(RES)
+  message(FATAL_ERROR "comparison failed")
+else()
+  message("comparison succeeded!")
+endif()
@@ -0,0 +1,74 @@
+#include <chrono>
+#include "pressiodemoapps/swe2d.hpp"
+#include "pressio-schwarz/schwarz_mpi.hpp"
+#include "../../observer.hpp"
+
+// Times distributed additive Schwarz on any decomposition from create_decomp_meshes.py.
+// Run as mpiexec -np <nranks> ./exe <meshRoot> <runtimeFile>, rank 0 writes the runtime of each outer step.
+// Strong scaling: same mesh, increasing ranks. Weak scaling: subdomains per rank fixed, mesh grows with ranks.
+
+int main(int argc, char *argv[])
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    MPI_Init(&argc, &argv);
+    int rank, nranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nranks);
+
+    const std::string meshRoot = (argc >= 2) ? argv[1] : "./mesh";
+    const std::string runtimeFile = (argc >= 3) ? argv[2] : "runtime.bin";
+
+    const auto probId = pda::Swe2d::CustomBCs;
+    using app_t = pschwarz::swe2d_app_type;
+    const int icFlag = 1;
+    std::vector<double> dt(1, 0.02);
+    const int numSteps = 10;
+    const int convergeStepMax = 10;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-11;
+
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRoot);
+    std::vector<pode::StepScheme> schemeVec(tiling->count(), pode::StepScheme::BDF1);
+    std::vector<pda::InviscidFluxReconstruction> orderVec(tiling->count(), pda::InviscidFluxReconstruction::FirstOrder);
+    auto [meshes, meshPaths] = pschwarz::create_meshes(meshRoot, tiling->count());
+    auto subdomains = pschwarz::create_owned_subdomains<app_t>(
+        pschwarz::mpi_owned_domains(*tiling), meshes, *tiling, probId, schemeVec, orderVec, icFlag);
+    pschwarz::SchwarzDecompMPI decomp(subdomains, tiling, dt);
+
+    std::unique_ptr<RuntimeObserver> obs_time;
+    if (rank == 0) {
+        obs_time = std::make_unique<RuntimeObserver>(runtimeFile);
+    }
+
+    double time = 0.0;
+    double secsTotal = 0.0;
+    for (int outerStep = 1; outerStep <= numSteps; ++outerStep)
+    {
+        MPI_Barrier(MPI_COMM_WORLD);
+        const auto runtimeStart = std::chrono::steady_clock::now();
+        const int numSubiters = decomp.calc_controller_step(
+            pschwarz::SchwarzMode::Additive, outerStep, time, rel_err_tol, abs_err_tol, convergeStepMax);
+        const auto runtimeEnd = std::chrono::steady_clock::now();
+        time += decomp.m_dtMax;
+
+        // slowest rank
+        double secs = std::chrono::duration<double>(runtimeEnd - runtimeStart).count();
+        MPI_Allreduce(MPI_IN_PLACE, &secs, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        secsTotal += secs;
+        if (rank == 0) {
+            (*obs_time)(secs, numSubiters);
+        }
+    }
+
+    if (rank == 0) {
+        std::cout << "ranks: " << nranks
+                  << ", subdomains: " << tiling->count()
+                  << ", runtime (s): " << secsTotal << std::endl;
+    }
+
+    obs_time.reset();
+    MPI_Finalize();
+    return 0;
+}
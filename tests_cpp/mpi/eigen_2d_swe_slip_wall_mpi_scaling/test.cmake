@@ -0,0 +1,41 @@
+include(FindUnixCommands)
+
+# strong scaling: 4x4 subdomains of one mesh on 1, 2, 4 ranks
+# weak scaling: 4 subdomains of 60x60 cells per rank
+set(RANKS 1 2 4)
+set(WEAKCELLS "120 120" "240 120" "240 240")
+set(WEAKDOMS "2 2" "4 2" "4 4")
+
+set(CMD "python3 ${DECOMPDRIVER} --meshScript ${MESHDRIVER} -n 240 240 --outDir ${OUTDIR}/mesh_strong -s 3 --bounds -5.0 5.0 -5.0 5.0 --numDoms 4 4 --overlap 10")
+message(NOTICE ${CMD})
+execute_process(COMMAND ${BASH} -c ${CMD} RESULT_VARIABLE RES)
+if(RES)
+  message(FATAL_ERROR "Mesh generation failed")
+endif()
+
+foreach(np cells doms IN ZIP_LISTS RANKS WEAKCELLS WEAKDOMS)
+  set(CMD "python3 ${DECOMPDRIVER} --meshScript ${MESHDRIVER} -n ${cells} --outDir ${OUTDIR}/mesh_weak_${np} -s 3 --bounds -5.0 5.0 -5.0 5.0 --numDoms ${doms} --overlap 10")
+  message(NOTICE ${CMD})
+  execute_process(COMMAND ${BASH} -c ${CMD} RESULT_VARIABLE RES)
+  if(RES)
+    message(FATAL_ERROR "Mesh generation failed")
+  endif()
+endforeach()
+
+foreach(np IN LISTS RANKS)
+  foreach(scaling strong weak)
+    if(scaling STREQUAL "strong")
+      set(MESHDIR ${OUTDIR}/mesh_strong)
+    else()
+      set(MESHDIR ${OUTDIR}/mesh_weak_${np})
+    endif()
+
+    set(CMD "${MPIEXEC} ${NPFLAG} ${np} ${MPIFLAGS} ${EXENAME} ${MESHDIR} ${OUTDIR}/runtime_${scaling}_np${np}.bin")
+    message(NOTICE ${CMD})
+    execute_process(COMMAND ${BASH} -c ${CMD} WORKING_DIRECTORY ${OUTDIR} RESULT_VARIABLE CMD_RESULT)
+    if(CMD_RESULT)
+      message(FATAL_ERROR "${scaling} scaling run on ${np} ranks failed")
+    endif()
+  endforeach()
+endforeach()
+message("run succeeded!")
@@ -2,21 +2,287 @@
 #ifndef PRESSIODEMOAPPS_TESTS_OBSERVER_HPP_
 #define PRESSIODEMOAPPS_TESTS_OBSERVER_HPP_
 
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#ifdef SCHWARZ_ENABLE_ZLIB
+#include <zlib.h>
+#endif
+
+// Optional compression of observer snapshot streams: byte-shuffle followed by zlib, optionally
+// preceded by quantization onto a uniform grid of spacing 2 * absTol (error <= absTol),
+// which is only meant for snapshots that feed POD.
+// Compressed files start with compressed_stream_magic, followed by one record per snapshot:
+//      uint64 count (doubles), uint64 payload bytes, double quantization step (0 if lossless), payload
+// Snapshots that cannot be quantized without overflow are stored losslessly (step 0).
+struct SnapshotCompression
+{
+    bool enabled = false;
+    double absTol = 0.0;  // <= 0 for lossless
+};
+
+inline constexpr char compressed_stream_magic[8] = {'P', 'S', 'C', 'H', 'W', 'Z', '0', '1'};
+
+// appends the compressed record of count doubles to out
+inline void encode_snapshot(const SnapshotCompression & compression,
+                            const double * data, const std::size_t count,
+                            std::vector<char> & out)
+{
+#ifdef SCHWARZ_ENABLE_ZLIB
+    const std::size_t bytes = count * sizeof(double);
+    double quantStep = (compression.absTol > 0.0) ? 2.0 * compression.absTol : 0.0;
+
+    // values off the int64 grid (or not finite) would overflow llround, such snapshots are stored losslessly
+    constexpr double maxQuantized = 4.0e18;
+    for (std::size_t i = 0; (quantStep > 0.0) && (i < count); ++i) {
+        if (!(std::abs(data[i] / quantStep) < maxQuantized)) { quantStep = 0.0; }
+    }
+
+    // lossy stage, integers on the quantization grid
+    std::vector<std::int64_t> quantized;
+    const char * raw = reinterpret_cast<const char *>(data);
+    if (quantStep > 0.0) {
+        quantized.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            quantized[i] = std::llround(data[i] / quantStep);
+        }
+        raw = reinterpret_cast<const char *>(quantized.data());
+    }
+
+    // byte-shuffle, so that the slowly varying high bytes of neighboring values are contiguous
+    std::vector<char> shuffled(bytes);
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t b = 0; b < sizeof(double); ++b) {
+            shuffled[b * count + i] = raw[i * sizeof(double) + b];
+        }
+    }
+
+    uLongf payloadBytes = compressBound(bytes);
+    const std::size_t headerBytes = 2 * sizeof(std::uint64_t) + sizeof(double);
+    const std::size_t start = out.size();
+    out.resize(start + headerBytes + payloadBytes);
+    if (compress2(reinterpret_cast<Bytef *>(out.data() + start + headerBytes), &payloadBytes,
+                  reinterpret_cast<const Bytef *>(shuffled.data()), bytes, Z_BEST_SPEED) != Z_OK) {
+        throw std::runtime_error("zlib compression of snapshot failed");
+    }
+    out.resize(start + headerBytes + payloadBytes);
+
+    const std::uint64_t header[2] = {count, payloadBytes};
+    std::memcpy(out.data() + start, header, sizeof(header));
+    std::memcpy(out.data() + start + sizeof(header), &quantStep, sizeof(double));
+#else
+    (void) compression; (void) data; (void) count; (void) out;
+    throw std::runtime_error("Snapshot compression requires building with SCHWARZ_ENABLE_ZLIB");
+#endif
+}
+
+// Background writer for observers. write() copies the data into one of a fixed number of
+// reusable staging buffers and returns, a dedicated I/O thread writes them out in FIFO order.
+// Once all buffers are queued, write() blocks until the I/O thread releases one (back-pressure).
+// Errors on the I/O thread are captured and rethrown from the next flush().
+class AsyncWriter
+{
+public:
+    explicit AsyncWriter(const std::size_t queueDepth)
+        : buffers_(queueDepth)
+    {
+        for (auto & buffer : buffers_) { free_.push_back(&buffer); }
+        thread_ = std::thread([this]{ run(); });
+    }
+
+    ~AsyncWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        workCv_.notify_one();
+        thread_.join();
+    }
+
+    AsyncWriter(const AsyncWriter &) = delete;
+    AsyncWriter & operator=(const AsyncWriter &) = delete;
+
+    // compressed data is encoded on the I/O thread
+    void write(std::ofstream & out, const char * data, const std::size_t bytes,
+               const SnapshotCompression compression = {})
+    {
+        std::vector<char> * buffer;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            freeCv_.wait(lock, [this]{ return !free_.empty(); });
+            buffer = free_.back();
+            free_.pop_back();
+        }
+
+        // buffers only grow, so steady-state snapshotting does not allocate
+        if (buffer->size() < bytes) { buffer->resize(bytes); }
+        std::memcpy(buffer->data(), data, bytes);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back({&out, buffer, bytes, compression});
+        }
+        workCv_.notify_one();
+    }
+
+    // blocks until everything queued so far has been written
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        freeCv_.wait(lock, [this]{ return free_.size() == buffers_.size(); });
+        if (error_) {
+            auto error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    struct Job {
+        std::ofstream * out;
+        std::vector<char> * buffer;
+        std::size_t bytes;
+        SnapshotCompression compression;
+    };
+
+    void run()
+    {
+        while (true) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                workCv_.wait(lock, [this]{ return stop_ || !queue_.empty(); });
+                if (queue_.empty()) { return; }
+                job = queue_.front();
+                queue_.pop_front();
+            }
+
+            std::exception_ptr error;
+            try {
+                if (job.compression.enabled) {
+                    encoded_.clear();
+                    encode_snapshot(job.compression, reinterpret_cast<const double *>(job.buffer->data()),
+                                    job.bytes / sizeof(double), encoded_);
+                    job.out->write(encoded_.data(), encoded_.size());
+                }
+                else {
+                    job.out->write(job.buffer->data(), job.bytes);
+                }
+                if (!job.out->good()) {
+                    throw std::runtime_error("Observer snapshot write failed");
+                }
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                free_.push_back(job.buffer);
+                if (error && !error_) { error_ = error; }
+            }
+            freeCv_.notify_all();
+        }
+    }
+
+    std::vector<std::vector<char>> buffers_;
+    std::vector<std::vector<char> *> free_;
+    std::deque<Job> queue_;
+    std::mutex mutex_;
+    std::condition_variable workCv_;
+    std::condition_variable freeCv_;
+    bool stop_ = false;
+    std::exception_ptr error_;   // first failure since the last flush()
+    std::vector<char> encoded_;  // only touched by the I/O thread
+    std::thread thread_;
+};
+
+// writes one snapshot of count doubles, from the calling thread or through writer if given
+inline void write_snapshot(std::ofstream & out, const double * data, const std::size_t count,
+                           AsyncWriter * writer, const SnapshotCompression & compression)
+{
+    const auto bytes = count * sizeof(double);
+    if (writer) {
+        writer->write(out, reinterpret_cast<const char *>(data), bytes, compression);
+    }
+    else if (compression.enabled) {
+        std::vector<char> encoded;
+        encode_snapshot(compression, data, count, encoded);
+        out.write(encoded.data(), encoded.size());
+    }
+    else {
+        out.write(reinterpret_cast<const char *>(data), bytes);
+    }
+}
+
+inline void open_snapshot_stream(std::ofstream & out, const SnapshotCompression & compression)
+{
+    if (compression.enabled) {
+        out.write(compressed_stream_magic, sizeof(compressed_stream_magic));
+    }
+}
+
+// destructors cannot throw, so writer errors not collected by an explicit flush() are reported
+inline void flush_on_destruction(AsyncWriter * writer)
+{
+    if (!writer) { return; }
+    try {
+        writer->flush();
+    }
+    catch (const std::exception & e) {
+        std::cerr << "Asynchronous observer write failed: " << e.what() << std::endl;
+    }
+}
+
 template <typename StateType>
 class FomObserver
 {
 public:
-    FomObserver(const std::string & f0, int freq)
+    // writer: if given, snapshots are handed to it instead of written on the calling thread,
+    //      observers may share one writer or each own one
+    FomObserver(const std::string & f0, int freq, std::shared_ptr<AsyncWriter> writer = nullptr,
+                const SnapshotCompression & compression = {})
         : myfile0_(f0,  std::ios::out | std::ios::binary),
-        sampleFreq_(freq){}
+        sampleFreq_(freq),
+        writer_(std::move(writer)),
+        compression_(compression)
+    {
+        open_snapshot_stream(myfile0_, compression_);
+    }
 
     ~FomObserver(){
+        flush_on_destruction(writer_.get());
         myfile0_.close();
     }
 
     FomObserver() = default;
     FomObserver & operator=(FomObserver &) = default;
-    FomObserver & operator=(FomObserver &&) = default;
+    // queued snapshots may still reference the stream being replaced
+    FomObserver & operator=(FomObserver && other) {
+        if (writer_) { writer_->flush(); }
+        if (other.writer_) { other.writer_->flush(); }
+        myfile0_ = std::move(other.myfile0_);
+        sampleFreq_ = other.sampleFreq_;
+        writer_ = std::move(other.writer_);
+        compression_ = other.compression_;
+        return *this;
+    }
+
+    // waits for queued snapshots, rethrows any error raised while writing them
+    void flush() const {
+        if (writer_) { writer_->flush(); }
+    }
 
     template<typename TimeType>
     void operator()(const pressio::ode::StepCount stepIn,
@@ -25,28 +291,43 @@ public:
     {
         const auto step = stepIn.get();
         if (step % sampleFreq_ == 0) {
-            const std::size_t ext = state.size()*sizeof(double);
-            myfile0_.write(reinterpret_cast<const char*>(&state(0)), ext);
+            write_snapshot(myfile0_, &state(0), state.size(), writer_.get(), compression_);
         }
     }
 
 private:
     mutable std::ofstream myfile0_;
     int sampleFreq_ = {};
+    std::shared_ptr<AsyncWriter> writer_;
+    SnapshotCompression compression_;
 };
 
 class StateObserver
 {
 public:
-    StateObserver(const std::string & f0, int freq)
+    StateObserver(const std::string & f0, int freq, std::shared_ptr<AsyncWriter> writer = nullptr,
+                  const SnapshotCompression & compression = {})
         : myfile_(f0,  std::ios::out | std::ios::binary),
-        sampleFreq_(freq){}
+        sampleFreq_(freq),
+        writer_(std::move(writer)),
+        compression_(compression)
+    {
+        open_snapshot_stream(myfile_, compression_);
+    }
 
     explicit StateObserver(int freq)
         : myfile_("state_snapshots.bin",  std::ios::out | std::ios::binary),
         sampleFreq_(freq){}
 
-    ~StateObserver(){ myfile_.close(); }
+    ~StateObserver(){
+        flush_on_destruction(writer_.get());
+        myfile_.close();
+    }
+
+    // waits for queued snapshots, rethrows any error raised while writing them
+    void flush() const {
+        if (writer_) { writer_->flush(); }
+    }
 
     template<typename TimeType, typename ObservableType>
     std::enable_if_t< pressio::is_vector_eigen<ObservableType>::value >
@@ -55,14 +336,123 @@ public:
                const ObservableType & state) const 
     {
         if (step.get() % sampleFreq_ == 0) {
-            const std::size_t ext = state.size()*sizeof(typename ObservableType::Scalar);
-            myfile_.write(reinterpret_cast<const char*>(&state(0)), ext);
+            static_assert(std::is_same<typename ObservableType::Scalar, double>::value,
+                          "snapshots are written as doubles");
+            write_snapshot(myfile_, &state(0), state.size(), writer_.get(), compression_);
         }
     }
 
 private:
     mutable std::ofstream myfile_;
     const int sampleFreq_ = {};
+    const std::shared_ptr<AsyncWriter> writer_;
+    const SnapshotCompression compression_ = {};
+};
+
+// Single-file snapshot container for all subdomains of a run, read by
+// python/pschwarz/data_utils.SnapshotContainer. Layout:
+//      header (SnapshotHeader, patched on close)
+//      chunks, one per (subdomain, step), each starting at a multiple of m_alignment bytes
+//      index, one SnapshotIndexEntry per chunk, at m_indexOffset
+class SnapshotContainer
+{
+public:
+    struct SnapshotHeader {
+        char m_magic[8] = {'P', 'S', 'C', 'H', 'W', 'S', 'N', 'P'};
+        std::uint64_t m_version = 1;
+        std::uint64_t m_ndomains = {};
+        std::uint64_t m_alignment = {};
+        std::uint64_t m_indexOffset = {};
+        std::uint64_t m_nchunks = {};
+    };
+
+    struct SnapshotIndexEntry {
+        std::uint64_t m_domIdx;
+        std::int64_t m_step;
+        double m_time;
+        std::uint64_t m_offset;  // bytes from start of file
+        std::uint64_t m_count;   // number of doubles
+    };
+
+    SnapshotContainer(const std::string & f0, const int ndomains, const std::size_t alignment = 64)
+        : file_(f0, std::ios::out | std::ios::binary),
+        padding_(alignment, 0),
+        writer_(16)
+    {
+        header_.m_ndomains = ndomains;
+        header_.m_alignment = alignment;
+        file_.write(reinterpret_cast<const char*>(&header_), sizeof(SnapshotHeader));
+        end_ = sizeof(SnapshotHeader);
+    }
+
+    ~SnapshotContainer()
+    {
+        flush_on_destruction(&writer_);
+        header_.m_indexOffset = end_;
+        header_.m_nchunks = index_.size();
+        file_.write(reinterpret_cast<const char*>(index_.data()), index_.size() * sizeof(SnapshotIndexEntry));
+        file_.seekp(0);
+        file_.write(reinterpret_cast<const char*>(&header_), sizeof(SnapshotHeader));
+        file_.close();
+    }
+
+    SnapshotContainer(const SnapshotContainer &) = delete;
+    SnapshotContainer & operator=(const SnapshotContainer &) = delete;
+
+    // chunks are appended by the background writer, in the order their offsets are assigned
+    void write(const int domIdx, const std::int64_t step, const double time,
+               const double * data, const std::size_t count)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const std::size_t pad = (header_.m_alignment - end_ % header_.m_alignment) % header_.m_alignment;
+        if (pad > 0) {
+            writer_.write(file_, padding_.data(), pad);
+        }
+        end_ += pad;
+        index_.push_back({static_cast<std::uint64_t>(domIdx), step, time, end_, count});
+        writer_.write(file_, reinterpret_cast<const char*>(data), count * sizeof(double));
+        end_ += count * sizeof(double);
+    }
+
+    // waits for queued chunks, rethrows any error raised while writing them
+    void flush() { writer_.flush(); }
+
+private:
+    std::ofstream file_;
+    SnapshotHeader header_;
+    std::vector<SnapshotIndexEntry> index_;
+    std::vector<char> padding_;
+    std::uint64_t end_ = {};
+    std::mutex mutex_;
+    AsyncWriter writer_;  // one I/O thread per container
+};
+
+// drop-in for FomObserver, writing into a SnapshotContainer shared by all subdomains
+template <typename StateType>
+class ContainerObserver
+{
+public:
+    ContainerObserver() = default;
+    ContainerObserver(std::shared_ptr<SnapshotContainer> container, int domIdx, int freq)
+        : container_(std::move(container)),
+        domIdx_(domIdx),
+        sampleFreq_(freq){}
+
+    template<typename TimeType>
+    void operator()(const pressio::ode::StepCount stepIn,
+                    const TimeType timeIn,
+                    const StateType & state) const
+    {
+        const auto step = stepIn.get();
+        if (step % sampleFreq_ == 0) {
+            container_->write(domIdx_, step, timeIn, &state(0), state.size());
+        }
+    }
+
+private:
+    std::shared_ptr<SnapshotContainer> container_;
+    int domIdx_ = {};
+    int sampleFreq_ = {};
 };
 
 class RuntimeObserver
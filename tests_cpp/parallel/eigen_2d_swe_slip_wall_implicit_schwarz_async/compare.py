@@ -0,0 +1,33 @@
+import struct
+import numpy as np
+
+
+def read_subiters(filename):
+    contents = open(filename, "rb").read()
+    assert len(contents) > 0
+    return [struct.unpack("Q", contents[nbytes_read:nbytes_read+8])[0]
+            for nbytes_read in range(0, len(contents), 16)]
+
+
+if __name__== "__main__":
+    nx = 24
+    ny = 24
+    fomTotDofs = nx * ny * 3
+
+    # asynchronous solution must match the sequential one within the Schwarz tolerance
+    allclose = []
+    for dom_idx in range(9):
+        D_serial = np.fromfile(f"swe_slipWall2d_solution_serial_{dom_idx}.bin")
+        D_async = np.fromfile(f"swe_slipWall2d_solution_async_{dom_idx}.bin")
+        assert D_serial.shape == D_async.shape
+        nt = int(np.size(D_async) / fomTotDofs)
+        assert nt == 26
+        assert np.isnan(D_async).any() == False
+        allclose.append(np.allclose(D_async, D_serial, rtol=1e-6, atol=1e-8))
+
+    assert all(allclose)
+
+    # every step must have solved each subdomain at least once, without running out of iterations
+    subiters_async = read_subiters("runtime_async.bin")
+    assert len(subiters_async) == 25
+    assert all([(nsubiters > 0) and (nsubiters < 50) for nsubiters in subiters_async])
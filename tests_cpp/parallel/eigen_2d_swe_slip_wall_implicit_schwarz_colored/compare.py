@@ -0,0 +1,76 @@
+import json
+import struct
+import numpy as np
+from argparse import ArgumentParser
+
+from pschwarz.data_utils import read_phase_table
+
+
+def read_subiters(filename):
+    f = open(filename, 'rb')
+    contents = f.read()
+    nbytes_file = len(contents)
+    assert nbytes_file > 0
+
+    nbytes_read = 0
+    subiters = []
+    while nbytes_read < nbytes_file:
+
+        nsubiters = struct.unpack('Q', contents[nbytes_read:nbytes_read+8])[0]
+        assert nsubiters > 0
+        nbytes_read += 8
+
+        runtime = struct.unpack('d', contents[nbytes_read:nbytes_read+8])[0]
+        assert runtime > 0.0
+        nbytes_read += 8
+
+        subiters.append(nsubiters)
+
+    return subiters
+
+
+if __name__== "__main__":
+    parser = ArgumentParser()
+    parser.add_argument("--golddir", dest="golddir")
+    args = parser.parse_args()
+
+    nx = 30
+    ny = 40
+    fomTotDofs = nx * ny * 3
+
+    # thread pool solution must match sequential colored sweep
+    allclose = []
+    for dom_idx in range(12):
+        D_serial = np.fromfile(args.golddir + f"/swe_slipWall2d_solution_serial_{dom_idx}.bin")
+        D_tp = np.fromfile(args.golddir + f"/swe_slipWall2d_solution_tp_{dom_idx}.bin")
+        assert D_serial.shape == D_tp.shape
+        nt = int(np.size(D_tp) / fomTotDofs)
+        assert nt == 51
+        assert np.isnan(D_tp).any() == False
+        allclose.append(np.allclose(D_tp, D_serial, rtol=1e-10, atol=1e-12))
+
+    assert all(allclose)
+
+    # check runtime files
+    subiters_serial = read_subiters(args.golddir + '/runtime_serial.bin')
+    subiters_tp = read_subiters(args.golddir + '/runtime_tp.bin')
+    assert len(subiters_serial) == 50
+    assert len(subiters_tp) == 50
+
+    # every subdomain steps once per Schwarz iteration, with identical nonlinear solves
+    phases_serial = read_phase_table(args.golddir + '/phases_serial.bin')
+    phases_tp = read_phase_table(args.golddir + '/phases_tp.bin')
+    step_idx = phases_serial["phases"].index("step")
+    solve_idx = phases_serial["phases"].index("linear solve")
+    assert phases_serial["calls"].shape[0] == 12
+    for phases in [phases_serial, phases_tp]:
+        # exclusive times, none negative
+        assert np.all(phases["seconds"] >= 0.0)
+    assert np.all(phases_serial["calls"][:, step_idx] == sum(subiters_serial))
+    assert np.all(phases_tp["calls"][:, step_idx] == sum(subiters_tp))
+    assert np.all(phases_serial["calls"][:, solve_idx] > 0)
+    assert np.array_equal(phases_serial["calls"][:, solve_idx], phases_tp["calls"][:, solve_idx])
+
+    trace = json.load(open(args.golddir + '/trace_tp.json'))
+    steps = [event for event in trace["traceEvents"] if event["name"] == "step"]
+    assert len(steps) == 12 * sum(subiters_tp)
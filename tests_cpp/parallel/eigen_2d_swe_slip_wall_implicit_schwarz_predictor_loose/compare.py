@@ -0,0 +1,40 @@
+import numpy as np
+from pschwarz.data_utils import read_runtimes
+
+if __name__== "__main__":
+    nx = 18
+    ny = 18
+    fomTotDofs = nx * ny * 3
+    nsteps = 50
+
+    def load(label):
+        sol = []
+        for dom_idx in range(4):
+            D = np.fromfile(f"swe_slipWall2d_solution_{label}_{dom_idx}.bin")
+            D = np.reshape(D, (-1, fomTotDofs))
+            assert D.shape[0] == nsteps + 1
+            assert np.isnan(D).any() == False
+            sol.append(D)
+        return np.concatenate(sol, axis=1)
+
+    def rel_err(sol, sol_ref):
+        return np.max(np.linalg.norm(sol - sol_ref, axis=1) / np.linalg.norm(sol_ref, axis=1))
+
+    # the loose runs take a single Schwarz iteration per outer step, so the predictor history is
+    #      only right if it receives the neighbor data of that iteration
+    for label in ["none", "linear", "linear_serial"]:
+        _, iters, subiters = read_runtimes(".", f"runtime_{label}")
+        assert iters[0] == nsteps
+        assert subiters[0] == nsteps
+
+    sol_ref = load("reference")
+    errs = {label: rel_err(load(label), sol_ref) for label in ["none", "linear", "linear_serial"]}
+    print(errs)
+
+    # double-buffered and sequential additive Schwarz take the same iterates
+    assert np.allclose(load("linear"), load("linear_serial"), rtol=1e-10, atol=1e-12)
+
+    # extrapolating the converged interface states is at least as good as lagging them by a step,
+    #      a predictor extrapolating from its own output drifts away from the reference instead
+    assert errs["linear"] < 1e-2
+    assert errs["linear"] <= errs["none"]
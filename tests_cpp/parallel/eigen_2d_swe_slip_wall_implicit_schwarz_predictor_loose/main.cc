@@ -0,0 +1,102 @@
+#include <chrono>
+#include "pressiodemoapps/swe2d.hpp"
+#include "pressio-schwarz/schwarz.hpp"
+#include "../../observer.hpp"
+#include "../../help_cmdline.hpp"
+
+int main(int argc, char *argv[])
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    const int numthreads = parse_num_threads(argc, argv);
+
+    // +++++ USER INPUTS +++++
+    std::string meshRoot = "./mesh";
+    const int obsFreq = 1;
+
+    const auto probId = pda::Swe2d::CustomBCs;
+    std::vector<pda::InviscidFluxReconstruction> orderVec(4, pda::InviscidFluxReconstruction::FirstOrder);
+    std::vector<pode::StepScheme> schemeVec(4, pode::StepScheme::BDF1);
+    const int icFlag = 1;
+    using app_t = pschwarz::swe2d_app_type;
+
+    const double tf = 1.0;
+    std::vector<double> dt(1, 0.02);
+    const int convergeStepMax = 50;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-8;
+    // loose enough that every outer step converges on its first Schwarz iteration
+    const double loose_rel_err_tol = 1e-1;
+
+    // +++++ END USER INPUTS +++++
+
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRoot);
+    auto [meshes, meshPaths] = pschwarz::create_meshes(meshRoot, tiling->count());
+
+    BS::thread_pool pool(numthreads);
+
+    // additive Schwarz converged tightly without prediction, as reference, and with the loose tolerance
+    //      without and with linear prediction, on the thread pool (double-buffered) and sequentially
+    for (const std::string runLabel : {"reference", "none", "linear", "linear_serial"}) {
+
+        const bool loose = (runLabel != "reference");
+        const bool serial = (runLabel == "linear_serial");
+
+        auto subdomains = pschwarz::create_subdomains<app_t>(
+            meshes, *tiling, probId, schemeVec, orderVec, icFlag);
+        pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+        if (runLabel.rfind("linear", 0) == 0) {
+            decomp.set_interface_predictor(pschwarz::InterfacePredict::Linear);
+        }
+
+        // observers
+        std::string obsRoot = "swe_slipWall2d_solution_" + runLabel;
+        using state_t = decltype(decomp)::state_t;
+        using obs_t = FomObserver<state_t>;
+        std::vector<obs_t> obsVec((*decomp.m_tiling).count());
+        for (int domIdx = 0; domIdx < (*decomp.m_tiling).count(); ++domIdx) {
+            obsVec[domIdx] = obs_t(obsRoot + "_" + std::to_string(domIdx) + ".bin", obsFreq);
+            obsVec[domIdx](::pressio::ode::StepCount(0), 0.0, *decomp.m_subdomainVec[domIdx]->getStateFull());
+        }
+        RuntimeObserver obs_time("runtime_" + runLabel + ".bin");
+
+        // solve
+        const int numSteps = std::round(tf / decomp.m_dtMax);
+        double time = 0.0;
+        for (int outerStep = 1; outerStep <= numSteps; ++outerStep)
+        {
+            std::cout << runLabel << " step " << outerStep << std::endl;
+
+            // compute contoller step until convergence
+            auto runtimeStart = std::chrono::high_resolution_clock::now();
+            const double relTol = loose ? loose_rel_err_tol : rel_err_tol;
+            int numSubiters;
+            if (serial) {
+                numSubiters = decomp.calc_controller_step(
+                    pschwarz::SchwarzMode::Additive,
+                    outerStep, time, relTol, abs_err_tol, convergeStepMax);
+            }
+            else {
+                numSubiters = decomp.calc_controller_step(
+                    pschwarz::SchwarzMode::Additive,
+                    outerStep, time, relTol, abs_err_tol, convergeStepMax, pool);
+            }
+            const auto runtimeEnd = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double, std::milli> duration = runtimeEnd - runtimeStart;
+            obs_time(duration.count() * 1e-3, numSubiters);
+
+            time += decomp.m_dtMax;
+
+            // output observer
+            if ((outerStep % obsFreq) == 0) {
+                const auto stepWrap = pode::StepCount(outerStep);
+                for (int domIdx = 0; domIdx < (*decomp.m_tiling).count(); ++domIdx) {
+                    obsVec[domIdx](stepWrap, time, *decomp.m_subdomainVec[domIdx]->getStateFull());
+                }
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,18 @@
+import os
+import numpy as np
+
+
+if __name__== "__main__":
+
+    ndomains = 12
+    labels = [label for label in ["tp", "omp"] if os.path.isfile(f"{label}_final_0.bin")]
+    assert "tp" in labels
+
+    # scheduling must not change the additive Schwarz solution
+    for dom_idx in range(ndomains):
+        ref = np.fromfile(f"tp_final_{dom_idx}.bin")
+        assert ref.size > 0
+        assert not np.isnan(ref).any()
+        for label in labels[1:]:
+            sol = np.fromfile(f"{label}_final_{dom_idx}.bin")
+            assert np.allclose(sol, ref, rtol=1e-10, atol=1e-12)
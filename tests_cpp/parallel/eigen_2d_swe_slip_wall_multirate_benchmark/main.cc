@@ -0,0 +1,84 @@
+#include <chrono>
+#include "pressiodemoapps/swe2d.hpp"
+#include "pressio-schwarz/schwarz.hpp"
+#include "../../help_cmdline.hpp"
+
+// Times additive Schwarz on a multi-rate decomposition, where the first column of subdomains
+// takes four controller steps per outer step, on a thread pool (one task per subdomain, most
+// expensive first) and with OpenMP schedule(static, 1).
+// The final solutions of all runs are written for comparison, e.g. ./exe <numthreads> <meshRoot>
+
+int main(int argc, char *argv[])
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    const int numthreads = parse_num_threads(argc, argv);
+    const std::string meshRoot = (argc >= 3) ? argv[2] : "./mesh";
+
+    const auto probId = pda::Swe2d::CustomBCs;
+    using app_t = pschwarz::swe2d_app_type;
+    const int icFlag = 1;
+    const int numSteps = 10;
+    const int convergeStepMax = 10;
+    const double abs_err_tol = 1e-11;
+    const double rel_err_tol = 1e-11;
+
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRoot);
+    tiling->describe();
+    const int ndomains = tiling->count();
+    std::vector<pode::StepScheme> schemeVec(ndomains, pode::StepScheme::BDF1);
+    std::vector<pda::InviscidFluxReconstruction> orderVec(ndomains, pda::InviscidFluxReconstruction::FirstOrder);
+    std::vector<double> dt(ndomains, 0.02);
+    for (int domIdx = 0; domIdx < ndomains; domIdx += tiling->countX()) {
+        dt[domIdx] = 0.005;
+    }
+    auto [meshes, meshPaths] = pschwarz::create_meshes(meshRoot, ndomains);
+
+    std::vector<std::string> runLabels = {"tp"};
+#if defined SCHWARZ_ENABLE_OMP
+    runLabels.push_back("omp");
+#endif
+
+    BS::thread_pool pool(numthreads);
+    for (const auto & runLabel : runLabels) {
+        auto subdomains = pschwarz::create_subdomains<app_t>(
+            meshes, *tiling, probId, schemeVec, orderVec, icFlag);
+        pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+
+        int totalSubiters = 0;
+        const auto runtimeStart = std::chrono::steady_clock::now();
+        if (runLabel == "omp") {
+#if defined SCHWARZ_ENABLE_OMP
+#pragma omp parallel num_threads(numthreads)
+{
+            double time = 0.0;
+            for (int outerStep = 1; outerStep <= numSteps; ++outerStep) {
+                const int numSubiters = decomp.additive_step(outerStep, time, rel_err_tol, abs_err_tol, convergeStepMax);
+                time += decomp.m_dtMax;
+#pragma omp master
+                totalSubiters += numSubiters;
+            }
+}
+#endif
+        }
+        else {
+            double time = 0.0;
+            for (int outerStep = 1; outerStep <= numSteps; ++outerStep) {
+                totalSubiters += decomp.additive_step(outerStep, time, rel_err_tol, abs_err_tol, convergeStepMax, pool);
+                time += decomp.m_dtMax;
+            }
+        }
+        const auto runtimeEnd = std::chrono::steady_clock::now();
+        std::cout << runLabel << " additive Schwarz, " << totalSubiters << " Schwarz iterations: "
+                  << std::chrono::duration<double>(runtimeEnd - runtimeStart).count() << " s\n";
+
+        for (int domIdx = 0; domIdx < ndomains; ++domIdx) {
+            const auto & state = *decomp.m_subdomainVec[domIdx]->getStateFull();
+            std::ofstream out(runLabel + "_final_" + std::to_string(domIdx) + ".bin", std::ios::binary);
+            out.write(reinterpret_cast<const char *>(state.data()), state.size() * sizeof(double));
+        }
+    }
+
+    return 0;
+}
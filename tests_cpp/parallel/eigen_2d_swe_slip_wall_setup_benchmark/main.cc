@@ -0,0 +1,55 @@
+#include <chrono>
+#include "pressiodemoapps/swe2d.hpp"
+#include "pressio-schwarz/schwarz.hpp"
+#include "../../help_cmdline.hpp"
+
+// Times mesh/subdomain construction and each phase of the Schwarz decomposition setup, sequentially and on a thread pool.
+// Run on any decomposition from create_decomp_meshes.py, e.g. ./exe <numthreads> <meshRoot>
+
+int main(int argc, char *argv[])
+{
+    namespace pda  = pressiodemoapps;
+    namespace pode = pressio::ode;
+
+    const int numthreads = parse_num_threads(argc, argv);
+    const std::string meshRoot = (argc >= 3) ? argv[2] : "./mesh";
+
+    const auto probId = pda::Swe2d::CustomBCs;
+    using app_t = pschwarz::swe2d_app_type;
+    const int icFlag = 1;
+    std::vector<double> dt(1, 0.02);
+
+    auto tiling = std::make_shared<pschwarz::Tiling>(meshRoot);
+    tiling->describe();
+    std::vector<pode::StepScheme> schemeVec(tiling->count(), pode::StepScheme::BDF1);
+    std::vector<pda::InviscidFluxReconstruction> orderVec(tiling->count(), pda::InviscidFluxReconstruction::FirstOrder);
+
+    BS::thread_pool pool(numthreads);
+    for (const std::string runLabel : {"serial", "tp"}) {
+        const auto constructStart = std::chrono::steady_clock::now();
+        auto [meshes, meshPaths] = (runLabel == "serial")
+            ? pschwarz::create_meshes(meshRoot, tiling->count())
+            : pschwarz::create_meshes(pool, meshRoot, tiling->count());
+        auto subdomains = (runLabel == "serial")
+            ? pschwarz::create_subdomains<app_t>(meshes, *tiling, probId, schemeVec, orderVec, icFlag)
+            : pschwarz::create_subdomains<app_t>(pool, meshes, *tiling, probId, schemeVec, orderVec, icFlag);
+        const auto constructEnd = std::chrono::steady_clock::now();
+        std::cout << runLabel << " mesh/subdomain construction: "
+                  << std::chrono::duration<double>(constructEnd - constructStart).count() << " s\n";
+
+        const auto runtimeStart = std::chrono::steady_clock::now();
+        if (runLabel == "serial") {
+            pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt);
+            decomp.print_setup_times();
+        }
+        else {
+            pschwarz::SchwarzDecomp decomp(subdomains, tiling, dt, pool);
+            decomp.print_setup_times();
+        }
+        const auto runtimeEnd = std::chrono::steady_clock::now();
+        std::cout << runLabel << " setup total: "
+                  << std::chrono::duration<double>(runtimeEnd - runtimeStart).count() << " s\n";
+    }
+
+    return 0;
+}